@@ -0,0 +1,65 @@
+#include <cstddef>  // byte
+#include <memory_resource>
+#include <vector>
+
+#include "bench.hpp"
+
+#include "array_list.hpp"
+#include "linked_list.hpp"
+
+using namespace itis;
+
+// кол-во элементов в списке, создаваемом при обработке одного "запроса"
+static constexpr int kElementsPerRequest = 256;
+
+template<typename List>
+static void fill_list(List &list) {
+  for (int index = 0; index < kElementsPerRequest; index++) {
+    list.Add(static_cast<Element>(index % 5));
+  }
+  bench::do_not_optimize(list.GetSize());
+}
+
+// куча: каждое выделение и освобождение памяти проходит через new/delete
+template<typename List, typename... Args>
+static double heap_requests(long long num_requests, Args... args) {
+  return bench::measure_ms([&] {
+    for (long long request = 0; request < num_requests; request++) {
+      List list(args..., std::pmr::new_delete_resource());
+      fill_list(list);
+    }
+  });
+}
+
+// арена: память выделяется из заранее выделенного буфера и высвобождается целиком после "запроса"
+template<typename List, typename... Args>
+static double arena_requests(long long num_requests, Args... args) {
+  std::vector<std::byte> buffer(1 << 20);
+
+  return bench::measure_ms([&] {
+    for (long long request = 0; request < num_requests; request++) {
+      std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+      {
+        List list(args..., &arena);
+        fill_list(list);
+      }
+    }
+  });
+}
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 1'000'000)) {
+    const long long num_requests = n / kElementsPerRequest + 1;
+    const long long num_ops = num_requests * kElementsPerRequest;
+
+    bench::report("LinkedList (new/delete)", num_ops, heap_requests<LinkedList>(num_requests));
+    bench::report("LinkedList (monotonic_buffer_resource)", num_ops, arena_requests<LinkedList>(num_requests));
+
+    const auto policy = GrowthPolicy::Geometric();
+    bench::report("ArrayList (new/delete)", num_ops,
+                  heap_requests<ArrayList>(num_requests, ArrayList::kInitCapacity, policy));
+    bench::report("ArrayList (monotonic_buffer_resource)", num_ops,
+                  arena_requests<ArrayList>(num_requests, ArrayList::kInitCapacity, policy));
+  }
+  return 0;
+}
@@ -0,0 +1,71 @@
+#include <cstdio>  // printf
+
+#include "bench.hpp"
+
+#include "array_deque.hpp"
+#include "array_list.hpp"
+
+using namespace itis;
+
+// ArrayList сдвигает весь массив при операциях в начале: ограничиваем размер, чтобы замер завершался
+constexpr long long kMaxArrayListElements = 100'000;
+
+// очередь: добавление в конец, извлечение из начала
+template<typename List>
+static double queue(long long num_elements) {
+  return bench::measure_ms([&] {
+    List list(1, GrowthPolicy::Geometric());
+    for (long long index = 0; index < num_elements; index++) {
+      list.Add(static_cast<Element>(index % 5));
+    }
+    for (long long index = 0; index < num_elements; index++) {
+      bench::do_not_optimize(list.Remove(0));
+    }
+  });
+}
+
+// стек в начале: добавление и извлечение из начала
+template<typename List>
+static double push_front(long long num_elements) {
+  return bench::measure_ms([&] {
+    List list(1, GrowthPolicy::Geometric());
+    for (long long index = 0; index < num_elements; index++) {
+      list.Insert(0, static_cast<Element>(index % 5));
+    }
+    bench::do_not_optimize(list.GetSize());
+  });
+}
+
+// скользящее окно: очередь фиксированного размера, на каждом шаге один элемент входит и один выходит
+template<typename List>
+static double sliding_window(long long window, long long num_steps) {
+  List list(1, GrowthPolicy::Geometric());
+  for (long long index = 0; index < window; index++) {
+    list.Add(static_cast<Element>(index % 5));
+  }
+  return bench::measure_ms([&] {
+    for (long long step = 0; step < num_steps; step++) {
+      list.Add(list.Remove(0));
+    }
+  });
+}
+
+int main(int argc, char **argv) {
+  constexpr long long kNumSteps = 1'000'000;
+
+  for (const long long n : bench::sizes(argc, argv, 10'000'000)) {
+    std::printf("n = %lld\n", n);
+
+    if (n <= kMaxArrayListElements) {
+      bench::report("  queue (ArrayList)", n, queue<ArrayList>(n));
+      bench::report("  push front (ArrayList)", n, push_front<ArrayList>(n));
+      // каждый шаг окна ~ O(n): уменьшаем кол-во шагов пропорционально размеру окна
+      const long long num_steps = kNumSteps * 1000 / n;
+      bench::report("  sliding window (ArrayList)", num_steps, sliding_window<ArrayList>(n, num_steps));
+    }
+    bench::report("  queue (ArrayDeque)", n, queue<ArrayDeque>(n));
+    bench::report("  push front (ArrayDeque)", n, push_front<ArrayDeque>(n));
+    bench::report("  sliding window (ArrayDeque)", kNumSteps, sliding_window<ArrayDeque>(n, kNumSteps));
+  }
+  return 0;
+}
@@ -0,0 +1,44 @@
+#include <vector>
+
+#include "bench.hpp"
+
+#include "array_list.hpp"
+#include "growth_policy.hpp"
+
+using namespace itis;
+
+// аддитивная стратегия квадратична: на больших размерах замер длится слишком долго
+static constexpr long long kMaxAdditiveElements = 100'000;
+
+static double add_elements(long long num_elements, GrowthPolicy policy) {
+  return bench::measure_ms([&] {
+    ArrayList list(ArrayList::kInitCapacity, policy);
+    for (long long index = 0; index < num_elements; index++) {
+      list.Add(static_cast<Element>(index % 5));
+    }
+    bench::do_not_optimize(list.GetSize());
+  });
+}
+
+static double push_back_elements(long long num_elements) {
+  return bench::measure_ms([&] {
+    std::vector<Element> elements;
+    for (long long index = 0; index < num_elements; index++) {
+      elements.push_back(static_cast<Element>(index % 5));
+    }
+    bench::do_not_optimize(elements.size());
+  });
+}
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 100'000'000)) {
+    if (n <= kMaxAdditiveElements) {
+      bench::report("ArrayList::Add (additive +10)", n,
+                    add_elements(n, GrowthPolicy::Additive(ArrayList::kCapacityGrowthCoefficient)));
+    }
+    bench::report("ArrayList::Add (geometric x1.5)", n, add_elements(n, GrowthPolicy::Geometric(1.5)));
+    bench::report("ArrayList::Add (geometric x2)", n, add_elements(n, GrowthPolicy::Geometric(2.0)));
+    bench::report("std::vector::push_back", n, push_back_elements(n));
+  }
+  return 0;
+}
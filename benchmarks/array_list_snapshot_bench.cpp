@@ -0,0 +1,52 @@
+#include <cstdio>  // printf
+#include <vector>  // vector
+
+#include "bench.hpp"
+
+#include "array_list.hpp"
+
+using namespace itis;
+
+// кол-во "читателей", каждому из которых нужна своя неизменяемая копия массива
+static constexpr int kNumReaders = 16;
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 10'000'000)) {
+    std::printf("n = %lld (%d readers)\n", n, kNumReaders);
+
+    ArrayList list(static_cast<int>(n), GrowthPolicy::Geometric());
+    for (long long index = 0; index < n; index++) {
+      list.Add(static_cast<Element>(index % 5));
+    }
+
+    // как до появления снимков: каждый читатель получает полную копию
+    bench::report("  Clone per reader", n, bench::measure_ms([&] {
+      std::vector<ArrayList> copies;
+      for (int reader = 0; reader < kNumReaders; reader++) {
+        copies.push_back(list.Clone());
+      }
+      bench::do_not_optimize(copies.back().GetSize());
+    }));
+
+    bench::report("  Snapshot per reader", n, bench::measure_ms([&] {
+      std::vector<ArrayListSnapshot> snapshots;
+      for (int reader = 0; reader < kNumReaders; reader++) {
+        snapshots.push_back(list.Snapshot());
+      }
+      bench::do_not_optimize(snapshots.back().GetSize());
+    }));
+
+    // цена копирования при записи: первое изменение после снимка копирует буфер, следующие - нет
+    {
+      const ArrayListSnapshot snapshot = list.Snapshot();
+      bench::report("  first Set after Snapshot (copy)", n, bench::measure_ms([&] {
+        list.Set(0, Element::GRAVITY_GUN);
+      }, 1));
+      bench::report("  next Set (in place)", n, bench::measure_ms([&] {
+        list.Set(1, Element::GRAVITY_GUN);
+      }, 1));
+      bench::do_not_optimize(snapshot.GetSize());
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <algorithm>  // min
+#include <chrono>     // steady_clock
+#include <cstdio>     // printf
+#include <cstdlib>    // strtoll
+#include <vector>
+
+namespace bench {
+
+/**
+ * Замер времени выполнения функции (лучший результат из нескольких повторов).
+ *
+ * @param function - замеряемая функция
+ * @param repeats - кол-во повторов
+ * @return время выполнения в миллисекундах
+ */
+template<typename Function>
+double measure_ms(Function &&function, int repeats = 3) {
+  double best_ms = 0.0;
+
+  for (int repeat = 0; repeat < repeats; repeat++) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto finish = std::chrono::steady_clock::now();
+
+    const double elapsed_ms = std::chrono::duration<double, std::milli>(finish - start).count();
+    best_ms = repeat == 0 ? elapsed_ms : std::min(best_ms, elapsed_ms);
+  }
+  return best_ms;
+}
+
+/**
+ * Вывод результата замера: время и пропускная способность (млн. операций в секунду).
+ *
+ * @param name - название замера
+ * @param num_ops - кол-во выполненных операций
+ * @param elapsed_ms - время выполнения в миллисекундах
+ */
+inline void report(const char *name, long long num_ops, double elapsed_ms) {
+  const double mops = elapsed_ms > 0.0 ? static_cast<double>(num_ops) / elapsed_ms / 1000.0 : 0.0;
+  std::printf("%-48s n = %-11lld %12.3f ms %10.2f Mops/s\n", name, num_ops, elapsed_ms, mops);
+}
+
+/**
+ * Запрет компилятору выбрасывать вычисление значения.
+ *
+ * @param value - значение, которое должно быть "использовано"
+ */
+template<typename T>
+inline void do_not_optimize(const T &value) {
+#if defined(__GNUC__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void *sink;
+  sink = &value;
+#endif
+}
+
+/**
+ * Размеры входных данных: 1K, 10K, ..., max_num_elements.
+ *
+ * @param argc, argv - аргументы командной строки (argv[1] - максимальный размер)
+ * @param default_max - максимальный размер по умолчанию
+ * @return список размеров
+ */
+inline std::vector<long long> sizes(int argc, char **argv, long long default_max) {
+  const long long max_num_elements = argc > 1 ? std::strtoll(argv[1], nullptr, 10) : default_max;
+
+  std::vector<long long> result;
+  for (long long n = 1000; n <= max_num_elements; n *= 10) {
+    result.push_back(n);
+  }
+  return result;
+}
+
+}  // namespace bench
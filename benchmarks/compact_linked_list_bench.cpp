@@ -0,0 +1,61 @@
+#include <cstdio>  // printf
+
+#include "bench.hpp"
+
+#include "compact_linked_list.hpp"
+#include "linked_list.hpp"
+
+using namespace itis;
+
+// заполнение списка попеременной вставкой в начало и в конец:
+// соседние элементы списка оказываются в слотах (узлах), далеких друг от друга в памяти
+template<typename List>
+static void fill_interleaved(List &list, long long num_elements) {
+  for (long long index = 0; index < num_elements; index++) {
+    const auto e = static_cast<Element>(index % 5);
+    if (index % 2 == 0) {
+      list.Add(e);
+    } else {
+      list.Insert(0, e);
+    }
+  }
+}
+
+// полный обход списка
+template<typename List>
+static double traverse(const List &list) {
+  return bench::measure_ms([&] {
+    bench::do_not_optimize(list.Count(Element::GRAVITY_GUN));
+  });
+}
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 10'000'000)) {
+    std::printf("n = %lld\n", n);
+
+    {
+      LinkedList list;
+      fill_interleaved(list, n);
+      bench::report("  LinkedList: traverse", n, traverse(list));
+      std::printf("  LinkedList: %d bytes per node (+ malloc overhead)\n", static_cast<int>(sizeof(Node)));
+    }
+
+    CompactLinkedList list;
+    fill_interleaved(list, n);
+    bench::report("  CompactLinkedList: traverse (interleaved slots)", n, traverse(list));
+
+    bench::report("  CompactLinkedList: Compact", n, bench::measure_ms([&] { list.Compact(); }, 1));
+    bench::report("  CompactLinkedList: traverse (compacted)", n, traverse(list));
+
+    bench::report("  CompactLinkedList: Get (sequential, compacted)", n, bench::measure_ms([&] {
+      for (int index = 0; index < list.GetSize(); index++) {
+        bench::do_not_optimize(list.Get(index));
+      }
+    }));
+
+    std::printf("  CompactLinkedList: %.2f bytes per node (capacity = %d)\n",
+                static_cast<double>(list.GetCapacity()) * CompactLinkedList::kBytesPerNode / static_cast<double>(n),
+                list.GetCapacity());
+  }
+  return 0;
+}
@@ -0,0 +1,86 @@
+#include <algorithm>  // min, max
+#include <cstdio>     // printf
+#include <mutex>      // mutex, lock_guard
+#include <thread>     // thread, hardware_concurrency
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+#include "array_list.hpp"
+#include "concurrent_array_list.hpp"
+
+using namespace itis;
+
+// размер диапазона, добавляемого одним вызовом (AddRange)
+static constexpr int kBatchSize = 64;
+
+// запуск num_threads потоков, каждый из которых выполняет produce(кол-во своих элементов)
+template<typename Produce>
+static void run_producers(int num_threads, long long num_elements, Produce &&produce) {
+  std::vector<std::thread> producers;
+  for (int producer = 0; producer < num_threads; producer++) {
+    const long long first = num_elements * producer / num_threads;
+    const long long last = num_elements * (producer + 1) / num_threads;
+    producers.emplace_back([&produce, count = last - first] { produce(count); });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+}
+
+int main(int argc, char **argv) {
+  // на машинах с малым числом ядер потоков все равно больше одного: видна цена конкуренции за мьютекс
+  const int max_threads = std::min(32, std::max(4, static_cast<int>(std::thread::hardware_concurrency())));
+  const std::vector<Element> batch(kBatchSize, Element::SECRET_BOX);
+
+  for (const long long n : bench::sizes(argc, argv, 10'000'000)) {
+    for (int num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+      std::printf("n = %lld, threads = %d\n", n, num_threads);
+
+      bench::report("  ArrayList + mutex: Add", n, bench::measure_ms([&] {
+        ArrayList list(ArrayList::kInitCapacity, GrowthPolicy::Geometric());
+        std::mutex mutex;
+        run_producers(num_threads, n, [&](long long count) {
+          for (long long added = 0; added < count; added++) {
+            const std::lock_guard<std::mutex> lock(mutex);
+            list.Add(Element::SECRET_BOX);
+          }
+        });
+        bench::do_not_optimize(list.GetSize());
+      }));
+
+      bench::report("  ArrayList + mutex: AddRange", n, bench::measure_ms([&] {
+        ArrayList list(ArrayList::kInitCapacity, GrowthPolicy::Geometric());
+        std::mutex mutex;
+        run_producers(num_threads, n, [&](long long count) {
+          for (long long added = 0; added < count; added += kBatchSize) {
+            const std::lock_guard<std::mutex> lock(mutex);
+            list.AddRange(batch.data(), static_cast<int>(std::min<long long>(kBatchSize, count - added)));
+          }
+        });
+        bench::do_not_optimize(list.GetSize());
+      }));
+
+      bench::report("  ConcurrentArrayList: Add", n, bench::measure_ms([&] {
+        ConcurrentArrayList list;
+        run_producers(num_threads, n, [&](long long count) {
+          for (long long added = 0; added < count; added++) {
+            list.Add(Element::SECRET_BOX);
+          }
+        });
+        bench::do_not_optimize(list.GetSize());
+      }));
+
+      bench::report("  ConcurrentArrayList: AddRange", n, bench::measure_ms([&] {
+        ConcurrentArrayList list;
+        run_producers(num_threads, n, [&](long long count) {
+          for (long long added = 0; added < count; added += kBatchSize) {
+            list.AddRange(batch.data(), static_cast<int>(std::min<long long>(kBatchSize, count - added)));
+          }
+        });
+        bench::do_not_optimize(list.GetSize());
+      }));
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,79 @@
+#include "bench.hpp"
+
+#include "array_list.hpp"
+#include "linked_list.hpp"
+
+using namespace itis;
+
+// кол-во запросов Contains на каждое изменение в смешанной нагрузке
+static constexpr int kQueriesPerMutation = 4;
+
+template<typename List>
+static void fill_list(List &list, long long num_elements) {
+  for (long long index = 0; index < num_elements; index++) {
+    list.Add(static_cast<Element>(index % 4));
+  }
+}
+
+template<typename List>
+static void run(List &list, long long num_elements, long long num_queries) {
+  // стоимость изменений: Set по кругу
+  bench::report("  Set", num_elements, bench::measure_ms([&] {
+    for (int index = 0; index < static_cast<int>(num_elements); index++) {
+      list.Set(index, static_cast<Element>(index % 3));
+    }
+  }));
+
+  // стоимость запросов: отсутствующий элемент требует полного прохода без статистики
+  bench::report("  Contains (not found)", num_queries, bench::measure_ms([&] {
+    for (long long query = 0; query < num_queries; query++) {
+      bench::do_not_optimize(list.Contains(Element::BEAUTIFUL_FLOWERS));
+    }
+  }));
+
+  bench::report("  Count", num_queries, bench::measure_ms([&] {
+    for (long long query = 0; query < num_queries; query++) {
+      bench::do_not_optimize(list.Count(Element::CHERRY_PIE));
+    }
+  }));
+
+  // смешанная нагрузка: изменение в конце + несколько запросов
+  bench::report("  Add/Remove + Contains", num_queries, bench::measure_ms([&] {
+    for (long long query = 0; query < num_queries; query++) {
+      list.Add(Element::DRAGON_BALL);
+      for (int repeat = 0; repeat < kQueriesPerMutation; repeat++) {
+        bench::do_not_optimize(list.Contains(Element::BEAUTIFUL_FLOWERS));
+      }
+      list.Remove(list.GetSize() - 1);
+    }
+  }));
+}
+
+template<typename List>
+static void run_both(const char *name, long long num_elements, long long num_queries) {
+  List plain;
+  fill_list(plain, num_elements);
+  std::printf("%s:\n", name);
+  run(plain, num_elements, num_queries);
+
+  List counted;
+  fill_list(counted, num_elements);
+  counted.EnableElementCounts();
+  std::printf("%s (element counts):\n", name);
+  run(counted, num_elements, num_queries);
+}
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 1'000'000)) {
+    // запросов столько, чтобы суммарная работа без статистики была ~ 10^8 сравнений
+    const long long num_queries = 100'000'000 / n + 1;
+
+    run_both<ArrayList>("ArrayList", n, num_queries);
+
+    if (n <= 1'000) {
+      // Set и Remove с конца у связного списка ~ O(n), на больших размерах замер длится слишком долго
+      run_both<LinkedList>("LinkedList", n, num_queries);
+    }
+  }
+  return 0;
+}
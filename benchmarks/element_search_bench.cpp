@@ -0,0 +1,54 @@
+#include <vector>
+
+#include "bench.hpp"
+
+#include "array_list.hpp"
+#include "private/element_search.hpp"
+
+using namespace itis;
+using namespace itis::internal;
+
+static const char *kernel_name(SearchKernel kernel) {
+  switch (kernel) {
+    case SearchKernel::SSE2:return "SSE2";
+    case SearchKernel::AVX2:return "AVX2";
+    case SearchKernel::AVX512:return "AVX-512";
+    default:return "scalar";
+  }
+}
+
+int main(int argc, char **argv) {
+  std::printf("default kernel: %s\n", kernel_name(best_search_kernel()));
+
+  for (const long long n : bench::sizes(argc, argv, 100'000'000)) {
+    // искомый элемент (BEAUTIFUL_FLOWERS) отсутствует: поиск проходит весь массив
+    std::vector<Element> elements(n);
+    for (long long index = 0; index < n; index++) {
+      elements[index] = static_cast<Element>(index % 4);
+    }
+    const auto size = static_cast<int>(n);
+
+    for (const auto kernel : {SearchKernel::SCALAR, SearchKernel::SSE2, SearchKernel::AVX2, SearchKernel::AVX512}) {
+      if (!is_supported(kernel)) continue;
+
+      std::printf("%s:\n", kernel_name(kernel));
+      bench::report("  IndexOf (not found)", n, bench::measure_ms([&] {
+        bench::do_not_optimize(index_of(elements.data(), size, Element::BEAUTIFUL_FLOWERS, kernel));
+      }));
+      bench::report("  LastIndexOf (not found)", n, bench::measure_ms([&] {
+        bench::do_not_optimize(last_index_of(elements.data(), size, Element::BEAUTIFUL_FLOWERS, kernel));
+      }));
+      bench::report("  Count", n, bench::measure_ms([&] {
+        bench::do_not_optimize(count(elements.data(), size, Element::CHERRY_PIE, kernel));
+      }));
+    }
+
+    ArrayList list(1, GrowthPolicy::Geometric());
+    list.AddRange(elements.data(), size);
+
+    bench::report("ArrayList::Contains (not found)", n, bench::measure_ms([&] {
+      bench::do_not_optimize(list.Contains(Element::BEAUTIFUL_FLOWERS));
+    }));
+  }
+  return 0;
+}
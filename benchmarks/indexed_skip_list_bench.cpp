@@ -0,0 +1,90 @@
+#include <cstdio>  // printf
+#include <random>  // mt19937, uniform_int_distribution
+#include <vector>  // vector
+
+#include "bench.hpp"
+
+#include "array_list.hpp"
+#include "indexed_skip_list.hpp"
+#include "linked_list.hpp"
+
+using namespace itis;
+
+// кол-во операций по случайному индексу в одном замере
+static constexpr int kNumOperations = 1000;
+
+// LinkedList ищет узел за O(n): на больших размерах замер занимает слишком много времени
+static constexpr long long kMaxLinkedListSize = 100'000;
+
+// случайные индексы (одинаковые для всех структур данных)
+static std::vector<int> random_indices(long long num_elements) {
+  auto engine = std::mt19937(42);
+  auto dist = std::uniform_int_distribution<int>(0, static_cast<int>(num_elements) - 1);
+
+  std::vector<int> indices(kNumOperations);
+  for (auto &index : indices) {
+    index = dist(engine);
+  }
+  return indices;
+}
+
+/**
+ * Замер операций по случайному индексу: Get, Set, Insert + Remove (размер списка не меняется).
+ */
+template<typename List>
+static void run(const char *name, List &list, long long num_elements) {
+  const std::vector<int> indices = random_indices(num_elements);
+
+  std::printf("  %s\n", name);
+
+  bench::report("    Get (random index)", kNumOperations, bench::measure_ms([&] {
+    for (const int index : indices) {
+      bench::do_not_optimize(list.Get(index));
+    }
+  }));
+
+  bench::report("    Set (random index)", kNumOperations, bench::measure_ms([&] {
+    for (const int index : indices) {
+      list.Set(index, Element::GRAVITY_GUN);
+    }
+  }));
+
+  bench::report("    Insert + Remove (random index)", kNumOperations, bench::measure_ms([&] {
+    for (const int index : indices) {
+      list.Insert(index, Element::DRAGON_BALL);
+      bench::do_not_optimize(list.Remove(index));
+    }
+  }));
+}
+
+template<typename List>
+static void fill_list(List &list, long long num_elements) {
+  for (long long index = 0; index < num_elements; index++) {
+    list.Add(static_cast<Element>(index % 5));
+  }
+}
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 1'000'000)) {
+    std::printf("n = %lld\n", n);
+
+    {
+      IndexedSkipList list(IndexedSkipList::kDefaultSeed);  // фиксированный seed: воспроизводимые замеры
+      fill_list(list, n);
+      run("IndexedSkipList", list, n);
+    }
+
+    {
+      ArrayList list;
+      fill_list(list, n);
+      run("ArrayList", list, n);
+    }
+
+    if (n <= kMaxLinkedListSize) {
+      LinkedList list;
+      fill_list(list, n);
+      run("LinkedList", list, n);
+    }
+  }
+  return 0;
+}
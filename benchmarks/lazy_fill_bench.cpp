@@ -0,0 +1,48 @@
+#include "bench.hpp"
+
+#include "array_list.hpp"
+
+using namespace itis;
+
+static double reserve(long long capacity, ArrayList::FillMode fill_mode) {
+  return bench::measure_ms([&] {
+    ArrayList list(static_cast<int>(capacity), fill_mode);
+    bench::do_not_optimize(list.GetCapacity());
+  });
+}
+
+static double reserve_and_add(long long capacity, long long num_elements, ArrayList::FillMode fill_mode) {
+  return bench::measure_ms([&] {
+    ArrayList list(static_cast<int>(capacity), fill_mode);
+    for (long long index = 0; index < num_elements; index++) {
+      list.Add(static_cast<Element>(index % 5));
+    }
+    bench::do_not_optimize(list.GetSize());
+  });
+}
+
+static double grow(long long num_elements, ArrayList::FillMode fill_mode) {
+  return bench::measure_ms([&] {
+    ArrayList list(1, fill_mode, GrowthPolicy::Geometric());
+    for (long long index = 0; index < num_elements; index++) {
+      list.Add(static_cast<Element>(index % 5));
+    }
+    bench::do_not_optimize(list.GetSize());
+  });
+}
+
+int main(int argc, char **argv) {
+  // 2^28 элементов ~ 1 ГБ
+  const long long kMaxCapacity = 1 << 28;
+
+  for (const long long n : bench::sizes(argc, argv, 100'000'000)) {
+    bench::report("reserve 1 GB (eager)", n, reserve_and_add(kMaxCapacity, n, ArrayList::FillMode::EAGER));
+    bench::report("reserve 1 GB (lazy)", n, reserve_and_add(kMaxCapacity, n, ArrayList::FillMode::LAZY));
+    bench::report("grow x2 (eager)", n, grow(n, ArrayList::FillMode::EAGER));
+    bench::report("grow x2 (lazy)", n, grow(n, ArrayList::FillMode::LAZY));
+  }
+
+  bench::report("reserve only 1 GB (eager)", kMaxCapacity, reserve(kMaxCapacity, ArrayList::FillMode::EAGER));
+  bench::report("reserve only 1 GB (lazy)", kMaxCapacity, reserve(kMaxCapacity, ArrayList::FillMode::LAZY));
+  return 0;
+}
@@ -0,0 +1,57 @@
+#include <cstdio>  // printf
+
+#include "bench.hpp"
+
+#include "linked_list.hpp"
+
+using namespace itis;
+
+// кол-во обращений по индексу в одном замере
+static constexpr int kNumAccesses = 1000;
+
+static void fill_list(LinkedList &list, long long num_elements) {
+  list.Clear();
+  for (long long index = 0; index < num_elements; index++) {
+    list.Add(static_cast<Element>(index % 5));
+  }
+}
+
+// обращение к элементу, находящемуся на расстоянии position * n от начала списка
+static double get_at(const LinkedList &list, double position) {
+  const int index = static_cast<int>(position * (list.GetSize() - 1));
+  return bench::measure_ms([&] {
+    for (int access = 0; access < kNumAccesses; access++) {
+      bench::do_not_optimize(list.Get(0));  // переносим палец в начало: поиск index идет от ближайшего конца, а не от пальца
+      bench::do_not_optimize(list.Get(index));
+    }
+  });
+}
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 100'000)) {
+    LinkedList list;
+    fill_list(list, n);
+
+    std::printf("n = %lld\n", n);
+    bench::report("  Get (1/4 of the list)", kNumAccesses, get_at(list, 0.25));
+    bench::report("  Get (middle)", kNumAccesses, get_at(list, 0.5));
+    bench::report("  Get (3/4 of the list)", kNumAccesses, get_at(list, 0.75));
+    bench::report("  Get (last but one)", kNumAccesses, get_at(list, 1.0 - 1.0 / static_cast<double>(n)));
+
+    // последовательный обход по индексу: каждый следующий поиск начинается с пальца
+    bench::report("  Get (sequential, all elements)", n, bench::measure_ms([&] {
+      for (int index = 0; index < list.GetSize(); index++) {
+        bench::do_not_optimize(list.Get(index));
+      }
+    }));
+
+    // извлечение всех элементов с конца списка (стек)
+    bench::report("  Remove (tail)", n, bench::measure_ms([&] {
+      fill_list(list, n);
+      while (!list.IsEmpty()) {
+        bench::do_not_optimize(list.Remove(list.GetSize() - 1));
+      }
+    }));
+  }
+  return 0;
+}
@@ -0,0 +1,69 @@
+#include <cstdio>  // printf
+
+#include "bench.hpp"
+
+#include "linked_list.hpp"
+
+using namespace itis;
+
+// проход по индексам стоит O(n^2): ограничиваем размер, чтобы замер завершался
+static constexpr long long kMaxIndexedElements = 10'000;
+
+static void fill_list(LinkedList &list, long long num_elements) {
+  list.Clear();
+  for (long long index = 0; index < num_elements; index++) {
+    list.Add(static_cast<Element>(index % 5));
+  }
+}
+
+// удаление всех элементов SECRET_BOX через индексы (каждое обращение ищет узел заново)
+static void filter_by_index(LinkedList &list) {
+  int index = 0;
+  while (index < list.GetSize()) {
+    if (list.Get(index) == Element::SECRET_BOX) {
+      list.Remove(index);
+    } else {
+      index += 1;
+    }
+  }
+}
+
+// то же самое через курсор за один проход
+static void filter_by_cursor(LinkedList &list) {
+  auto cursor = list.BeforeBegin();
+  while (cursor.HasNext()) {
+    if (cursor.GetNext() == Element::SECRET_BOX) {
+      cursor.EraseAfter();
+    } else {
+      cursor.Next();
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 1'000'000)) {
+    LinkedList list;
+    std::printf("n = %lld\n", n);
+
+    if (n <= kMaxIndexedElements) {
+      bench::report("  filter (Get/Remove by index)", n, bench::measure_ms([&] {
+        fill_list(list, n);
+        filter_by_index(list);
+      }));
+    }
+    bench::report("  filter (cursor)", n, bench::measure_ms([&] {
+      fill_list(list, n);
+      filter_by_cursor(list);
+    }));
+
+    fill_list(list, n);
+    bench::report("  range-based for", n, bench::measure_ms([&] {
+      int num_found = 0;
+      for (const Element e : list) {
+        num_found += e == Element::DRAGON_BALL ? 1 : 0;
+      }
+      bench::do_not_optimize(num_found);
+    }));
+  }
+  return 0;
+}
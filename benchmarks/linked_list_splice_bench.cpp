@@ -0,0 +1,86 @@
+#include <algorithm>  // min
+#include <cstdio>     // printf
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+#include "linked_list.hpp"
+
+using namespace itis;
+
+// кол-во частей (шардов), на которые делится список
+static constexpr int kNumShards = 16;
+
+static void fill_list(LinkedList &list, long long num_elements) {
+  for (long long index = 0; index < num_elements; index++) {
+    list.Add(static_cast<Element>(index % 5));
+  }
+}
+
+// сборка списка из шардов: поэлементное копирование (как до появления Splice) или перевязка узлов
+static double concatenate(long long num_elements, bool relink) {
+  double total_ms = 0.0;
+
+  for (int repeat = 0; repeat < 3; repeat++) {
+    std::vector<LinkedList> shards(kNumShards);
+    for (auto &shard : shards) {
+      fill_list(shard, num_elements / kNumShards);
+    }
+
+    LinkedList result;
+    const double elapsed_ms = bench::measure_ms([&] {
+      for (auto &shard : shards) {
+        if (relink) {
+          result.Splice(std::move(shard));
+        } else {
+          for (const Element e : shard) result.Add(e);
+          shard.Clear();
+        }
+      }
+    }, 1);
+
+    bench::do_not_optimize(result.GetSize());
+    total_ms = repeat == 0 ? elapsed_ms : std::min(total_ms, elapsed_ms);
+  }
+  return total_ms;
+}
+
+// деление списка на шарды: поэлементное копирование хвоста или отделение суффикса
+static double shard(long long num_elements, bool relink) {
+  LinkedList list;
+  fill_list(list, num_elements);
+
+  std::vector<LinkedList> shards;
+  return bench::measure_ms([&] {
+    const int shard_size = list.GetSize() / kNumShards;
+    while (list.GetSize() > shard_size) {
+      const int index = list.GetSize() - shard_size;
+      if (relink) {
+        shards.push_back(list.SplitAt(index));
+      } else {
+        LinkedList part;
+        for (auto cursor = list.CursorAt(index - 1); cursor.HasNext();) {
+          part.Add(cursor.EraseAfter());
+        }
+        shards.push_back(std::move(part));
+      }
+    }
+
+    // обратная сборка для следующего повтора
+    for (auto it = shards.rbegin(); it != shards.rend(); ++it) {
+      list.Splice(std::move(*it));
+    }
+    shards.clear();
+  }, 1);
+}
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 1'000'000)) {
+    std::printf("n = %lld (%d shards)\n", n, kNumShards);
+    bench::report("  concatenate (Add per element)", n, concatenate(n, false));
+    bench::report("  concatenate (Splice)", n, concatenate(n, true));
+    bench::report("  shard + concatenate (copy)", n, shard(n, false));
+    bench::report("  shard + concatenate (SplitAt)", n, shard(n, true));
+  }
+  return 0;
+}
@@ -0,0 +1,85 @@
+#include <algorithm>        // shuffle, count
+#include <cstddef>          // size_t, max_align_t
+#include <cstdio>           // printf
+#include <memory_resource>  // memory_resource
+#include <new>              // bad_alloc
+#include <numeric>          // iota
+#include <random>           // mt19937
+#include <vector>           // vector
+
+#include "bench.hpp"
+
+#include "linked_list.hpp"
+
+using namespace itis;
+
+/**
+ * Источник памяти, выдающий ячейки под узлы из одного массива в перемешанном порядке:
+ * соседние узлы списка оказываются в случайных местах массива (как у списка, долго живущего в куче),
+ * и каждый переход по указателю - промах кэша.
+ */
+class ShuffledNodeResource final : public std::pmr::memory_resource {
+ private:
+  static constexpr std::size_t kCellSize = (sizeof(Node) + alignof(std::max_align_t) - 1) /
+                                           alignof(std::max_align_t) * alignof(std::max_align_t);
+
+  std::vector<std::max_align_t> cells_;
+  std::vector<std::size_t> order_;
+  std::size_t num_allocated_{0};
+
+ public:
+  explicit ShuffledNodeResource(std::size_t num_cells)
+      : cells_(num_cells * kCellSize / sizeof(std::max_align_t)), order_(num_cells) {
+    std::iota(order_.begin(), order_.end(), 0);
+    std::shuffle(order_.begin(), order_.end(), std::mt19937(42));
+  }
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t) override {
+    if (bytes > kCellSize || num_allocated_ == order_.size()) throw std::bad_alloc();
+    return reinterpret_cast<char *>(cells_.data()) + order_[num_allocated_++] * kCellSize;
+  }
+
+  // ячейки освобождаются только вместе с источником памяти
+  void do_deallocate(void *, std::size_t, std::size_t) override {}
+
+  bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 10'000'000)) {
+    std::printf("n = %lld\n", n);
+
+    ShuffledNodeResource resource(static_cast<std::size_t>(n));
+    LinkedList list(&resource);
+    for (long long index = 0; index < n; index++) {
+      list.Add(static_cast<Element>(index % 5));
+    }
+
+    // последовательная погоня за указателями: один промах кэша за раз
+    bench::report("  count (iterators, serial chase)", n, bench::measure_ms([&] {
+      bench::do_not_optimize(std::count(list.begin(), list.end(), Element::GRAVITY_GUN));
+    }));
+    bench::report("  Count (both ends)", n, bench::measure_ms([&] {
+      bench::do_not_optimize(list.Count(Element::GRAVITY_GUN));
+    }));
+
+    bench::report("  IndexOf missing (both ends)", n, bench::measure_ms([&] {
+      bench::do_not_optimize(list.IndexOf(Element::UNINITIALIZED));
+    }));
+
+    std::vector<Element> elements(static_cast<std::size_t>(n));
+    bench::report("  copy out (range-for)", n, bench::measure_ms([&] {
+      std::size_t index = 0;
+      for (const Element e : list) elements[index++] = e;
+      bench::do_not_optimize(elements.data());
+    }));
+    bench::report("  copy out (ForEach)", n, bench::measure_ms([&] {
+      list.ForEach([&](int index, Element e) { elements[index] = e; });
+      bench::do_not_optimize(elements.data());
+    }));
+  }
+  return 0;
+}
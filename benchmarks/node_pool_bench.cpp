@@ -0,0 +1,47 @@
+#include <cstdio>  // printf
+
+#include "bench.hpp"
+
+#include "linked_list.hpp"
+
+using namespace itis;
+
+// кол-во элементов в списке во время "перемешивания"
+static constexpr int kLiveElements = 1000;
+
+// перемешивание: удаление первого элемента и добавление нового в конец (очередь постоянного размера)
+static double churn(LinkedList::NodeAllocation allocation, long long num_ops) {
+  LinkedList list(allocation);
+  for (int index = 0; index < kLiveElements; index++) {
+    list.Add(static_cast<Element>(index % 5));
+  }
+
+  return bench::measure_ms([&] {
+    for (long long op = 0; op < num_ops; op++) {
+      list.Add(list.Remove(0));
+    }
+    bench::do_not_optimize(list.GetSize());
+  });
+}
+
+// заполнение и очистка списка
+static double fill_and_clear(LinkedList::NodeAllocation allocation, long long num_elements) {
+  LinkedList list(allocation);
+
+  return bench::measure_ms([&] {
+    for (long long index = 0; index < num_elements; index++) {
+      list.Add(static_cast<Element>(index % 5));
+    }
+    list.Clear();
+  });
+}
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 10'000'000)) {
+    bench::report("churn Add/Remove (heap)", n, churn(LinkedList::NodeAllocation::HEAP, n));
+    bench::report("churn Add/Remove (pool)", n, churn(LinkedList::NodeAllocation::POOL, n));
+    bench::report("fill and clear (heap)", n, fill_and_clear(LinkedList::NodeAllocation::HEAP, n));
+    bench::report("fill and clear (pool)", n, fill_and_clear(LinkedList::NodeAllocation::POOL, n));
+  }
+  return 0;
+}
@@ -0,0 +1,53 @@
+#include <cstdio>  // printf
+#include <vector>
+
+#include "bench.hpp"
+
+#include "array_list.hpp"
+#include "packed_array_list.hpp"
+
+using namespace itis;
+
+template<typename List>
+static void fill_list(List &list, long long num_elements) {
+  list.Clear();
+  for (long long index = 0; index < num_elements; index++) {
+    // искомый элемент (BEAUTIFUL_FLOWERS) отсутствует: поиск проходит весь массив
+    list.Add(static_cast<Element>(index % 4));
+  }
+}
+
+template<typename List>
+static void run(List &list, long long num_elements) {
+  bench::report("  Add", num_elements, bench::measure_ms([&] {
+    fill_list(list, num_elements);
+  }));
+  bench::report("  IndexOf (not found)", num_elements, bench::measure_ms([&] {
+    bench::do_not_optimize(list.IndexOf(Element::BEAUTIFUL_FLOWERS));
+  }));
+}
+
+static double megabytes(long long bytes) {
+  return static_cast<double>(bytes) / (1 << 20);
+}
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 100'000'000)) {
+    ArrayList plain(1, GrowthPolicy::Geometric());
+    std::printf("ArrayList:\n");
+    run(plain, n);
+    std::printf("  memory: %.2f MB\n", megabytes(static_cast<long long>(sizeof(Element)) * plain.GetCapacity()));
+
+    PackedArrayList packed(1);
+    std::printf("PackedArrayList:\n");
+    run(packed, n);
+    std::printf("  memory: %.2f MB\n", megabytes(packed.GetMemoryUsage()));
+
+    std::vector<Element> unpacked(n);
+    bench::report("  Unpack", n, bench::measure_ms([&] {
+      packed.Unpack(0, static_cast<int>(n), unpacked.data());
+      bench::do_not_optimize(unpacked.back());
+    }));
+  }
+  return 0;
+}
@@ -0,0 +1,74 @@
+#include <algorithm>  // max
+#include <cstdio>     // printf
+#include <memory>     // unique_ptr
+#include <thread>     // hardware_concurrency
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+#include "array_list.hpp"
+#include "thread_pool.hpp"
+
+using namespace itis;
+
+int main(int argc, char **argv) {
+  // кол-во исполнителей (рабочие потоки + вызывающий поток): 1, 2, 4, ... до кол-ва ядер
+  const int max_executors = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+  for (const long long n : bench::sizes(argc, argv, 10'000'000)) {
+    std::printf("n = %lld\n", n);
+
+    ArrayList list(static_cast<int>(n), GrowthPolicy::Geometric());
+    for (long long index = 0; index < n; index++) {
+      list.Add(static_cast<Element>(index % 5));
+    }
+    std::vector<Element> output(static_cast<std::size_t>(n));
+
+    // последовательные проходы (как до появления параллельных операций)
+    bench::report("  serial: Count", n, bench::measure_ms([&] {
+      bench::do_not_optimize(list.Count(Element::GRAVITY_GUN));
+    }));
+    bench::report("  serial: IndexOf (missing)", n, bench::measure_ms([&] {
+      bench::do_not_optimize(list.IndexOf(Element::UNINITIALIZED));
+    }));
+    bench::report("  serial: replace loop over Get/Set", n, bench::measure_ms([&] {
+      for (int index = 0; index < list.GetSize(); index++) {
+        if (list.Get(index) == Element::SECRET_BOX) list.Set(index, Element::SECRET_BOX);
+      }
+    }));
+    bench::report("  serial: copy loop over Get", n, bench::measure_ms([&] {
+      for (int index = 0; index < list.GetSize(); index++) {
+        output[index] = list.Get(index);
+      }
+      bench::do_not_optimize(output.data());
+    }));
+
+    for (int num_executors = 1; num_executors <= max_executors; num_executors *= 2) {
+      ThreadPool pool(num_executors - 1);
+      std::printf("  %d executor(s):\n", num_executors);
+
+      bench::report("    ParallelCount", n, bench::measure_ms([&] {
+        bench::do_not_optimize(list.ParallelCount(Element::GRAVITY_GUN, pool));
+      }));
+      bench::report("    ParallelIndexOf (missing)", n, bench::measure_ms([&] {
+        bench::do_not_optimize(list.ParallelIndexOf(Element::UNINITIALIZED, pool));
+      }));
+      bench::report("    ParallelIndexOf (at n / 2)", n, bench::measure_ms([&] {
+        list.Set(static_cast<int>(n / 2), Element::UNINITIALIZED);
+        bench::do_not_optimize(list.ParallelIndexOf(Element::UNINITIALIZED, pool));
+        list.Set(static_cast<int>(n / 2), Element::CHERRY_PIE);
+      }));
+      bench::report("    ParallelReplace", n, bench::measure_ms([&] {
+        bench::do_not_optimize(list.ParallelReplace(Element::SECRET_BOX, Element::SECRET_BOX, pool));
+      }));
+      bench::report("    ParallelReplace (missing)", n, bench::measure_ms([&] {
+        bench::do_not_optimize(list.ParallelReplace(Element::UNINITIALIZED, Element::SECRET_BOX, pool));
+      }));
+      bench::report("    ParallelForEach (copy)", n, bench::measure_ms([&] {
+        list.ParallelForEach([&output](int index, Element e) { output[index] = e; }, pool);
+        bench::do_not_optimize(output.data());
+      }));
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,98 @@
+#include <algorithm>        // max
+#include <cstddef>          // size_t
+#include <cstdio>           // printf
+#include <memory_resource>  // memory_resource, new_delete_resource
+
+#include "bench.hpp"
+
+#include "array_list.hpp"
+#include "growth_policy.hpp"
+#include "segmented_array_list.hpp"
+
+using namespace itis;
+
+// источник памяти поверх кучи, запоминающий пиковый объем занятой памяти
+class PeakCountingResource final : public std::pmr::memory_resource {
+ public:
+  std::size_t bytes_in_use{0};
+  std::size_t peak_bytes{0};
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    void *ptr = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    bytes_in_use += bytes;
+    peak_bytes = std::max(peak_bytes, bytes_in_use);
+    return ptr;
+  }
+
+  void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    bytes_in_use -= bytes;
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+static void report_memory(const char *name, const PeakCountingResource &resource, long long n) {
+  std::printf("  %-40s peak %8.1f MiB, live %8.1f MiB, peak / elements %.2f\n", name,
+              static_cast<double>(resource.peak_bytes) / (1 << 20),
+              static_cast<double>(resource.bytes_in_use) / (1 << 20),
+              static_cast<double>(resource.peak_bytes) / (static_cast<double>(n) * sizeof(Element)));
+}
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 100'000'000)) {
+    std::printf("n = %lld\n", n);
+
+    // рост добавлением по одному элементу
+    bench::report("  ArrayList::Add (geometric x2)", n, bench::measure_ms([&] {
+      ArrayList list(ArrayList::kInitCapacity, GrowthPolicy::Geometric(2.0));
+      for (long long index = 0; index < n; index++) {
+        list.Add(static_cast<Element>(index % 5));
+      }
+      bench::do_not_optimize(list.GetSize());
+    }));
+    bench::report("  SegmentedArrayList::Add", n, bench::measure_ms([&] {
+      SegmentedArrayList list;
+      for (long long index = 0; index < n; index++) {
+        list.Add(static_cast<Element>(index % 5));
+      }
+      bench::do_not_optimize(list.GetSize());
+    }));
+
+    // пиковое потребление памяти при росте: старый и новый буферы ArrayList живут одновременно
+    PeakCountingResource array_resource;
+    ArrayList array_list(ArrayList::kInitCapacity, GrowthPolicy::Geometric(2.0), &array_resource);
+    PeakCountingResource segmented_resource;
+    SegmentedArrayList segmented_list(&segmented_resource);
+
+    for (long long index = 0; index < n; index++) {
+      array_list.Add(static_cast<Element>(index % 5));
+      segmented_list.Add(static_cast<Element>(index % 5));
+    }
+    report_memory("ArrayList (geometric x2)", array_resource, n);
+    report_memory("SegmentedArrayList", segmented_resource, n);
+
+    // произвольный доступ: сдвиг и маска против прямой индексации
+    bench::report("  ArrayList::Get (sequential)", n, bench::measure_ms([&] {
+      int sum = 0;
+      for (int index = 0; index < array_list.GetSize(); index++) {
+        sum += static_cast<int>(array_list.Get(index));
+      }
+      bench::do_not_optimize(sum);
+    }));
+    bench::report("  SegmentedArrayList::Get (sequential)", n, bench::measure_ms([&] {
+      int sum = 0;
+      for (int index = 0; index < segmented_list.GetSize(); index++) {
+        sum += static_cast<int>(segmented_list.Get(index));
+      }
+      bench::do_not_optimize(sum);
+    }));
+    bench::report("  SegmentedArrayList::Count", n, bench::measure_ms([&] {
+      bench::do_not_optimize(segmented_list.Count(Element::GRAVITY_GUN));
+    }));
+  }
+  return 0;
+}
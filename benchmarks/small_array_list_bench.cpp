@@ -0,0 +1,30 @@
+#include "bench.hpp"
+
+#include "array_list.hpp"
+#include "small_array_list.hpp"
+
+using namespace itis;
+
+// создание, заполнение и уничтожение num_lists небольших массивов по num_elements элементов
+template<typename List>
+static double create_small_lists(long long num_lists, int num_elements) {
+  return bench::measure_ms([&] {
+    for (long long list_index = 0; list_index < num_lists; list_index++) {
+      List list;
+      for (int index = 0; index < num_elements; index++) {
+        list.Add(static_cast<Element>(index % 5));
+      }
+      bench::do_not_optimize(list.GetSize());
+    }
+  });
+}
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 10'000'000)) {
+    bench::report("8 elements (ArrayList)", n, create_small_lists<ArrayList>(n, 8));
+    bench::report("8 elements (SmallArrayList<16>)", n, create_small_lists<SmallArrayList<16>>(n, 8));
+    bench::report("32 elements (ArrayList)", n, create_small_lists<ArrayList>(n, 32));
+    bench::report("32 elements (SmallArrayList<16>)", n, create_small_lists<SmallArrayList<16>>(n, 32));
+  }
+  return 0;
+}
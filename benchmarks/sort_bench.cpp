@@ -0,0 +1,92 @@
+#include <algorithm>  // sort, min
+#include <cstdio>     // printf
+#include <random>     // mt19937, uniform_int_distribution
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+#include "array_list.hpp"
+#include "linked_list.hpp"
+
+using namespace itis;
+
+// кол-во повторов замера (лучший результат)
+static constexpr int kNumRepeats = 3;
+
+static std::vector<Element> random_elements(long long num_elements) {
+  auto engine = std::mt19937(42);
+  auto dist = std::uniform_int_distribution<>(0, static_cast<int>(Element::UNINITIALIZED) - 1);
+
+  std::vector<Element> elements(num_elements);
+  for (auto &e : elements) {
+    e = static_cast<Element>(dist(engine));
+  }
+  return elements;
+}
+
+/**
+ * Замер сортировки: перед каждым повтором контейнер заново заполняется несортированными элементами,
+ * заполнение в замер не входит.
+ */
+template<typename Fill, typename Sort>
+static double measure_sort(Fill &&fill, Sort &&sort) {
+  double best_ms = 0.0;
+
+  for (int repeat = 0; repeat < kNumRepeats; repeat++) {
+    fill();
+    const double elapsed_ms = bench::measure_ms(sort, 1);
+    best_ms = repeat == 0 ? elapsed_ms : std::min(best_ms, elapsed_ms);
+  }
+  return best_ms;
+}
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 10'000'000)) {
+    const std::vector<Element> elements = random_elements(n);
+    std::printf("n = %lld\n", n);
+
+    ArrayList array_list;
+    const auto fill_array_list = [&] {
+      array_list.Clear();
+      array_list.AddRange(elements.data(), static_cast<int>(elements.size()));
+    };
+
+    bench::report("  ArrayList::Sort (counting)", n, measure_sort(fill_array_list, [&] { array_list.Sort(); }));
+
+    bench::report("  ArrayList: extract + std::sort + store", n, measure_sort(fill_array_list, [&] {
+      std::vector<Element> extracted(array_list.GetSize());
+      for (int index = 0; index < array_list.GetSize(); index++) {
+        extracted[index] = array_list.Get(index);
+      }
+      std::sort(extracted.begin(), extracted.end());
+      for (int index = 0; index < array_list.GetSize(); index++) {
+        array_list.Set(index, extracted[index]);
+      }
+    }));
+
+    // узлы из слабов пула: после Clear и повторного заполнения узлы снова лежат в памяти подряд
+    // (иначе после StableSort освобожденные вразнобой узлы кучи переиспользуются в случайном порядке)
+    LinkedList linked_list(LinkedList::NodeAllocation::POOL);
+    const auto fill_linked_list = [&] {
+      linked_list.Clear();
+      for (const Element e : elements) {
+        linked_list.Add(e);
+      }
+    };
+
+    bench::report("  LinkedList::StableSort (bucket relinking)", n,
+                  measure_sort(fill_linked_list, [&] { linked_list.StableSort(); }));
+
+    bench::report("  LinkedList: extract + std::sort + store", n, measure_sort(fill_linked_list, [&] {
+      std::vector<Element> extracted(linked_list.begin(), linked_list.end());
+      std::sort(extracted.begin(), extracted.end());
+
+      auto cursor = linked_list.BeforeBegin();
+      for (const Element e : extracted) {
+        cursor.Next();
+        cursor.Set(e);
+      }
+    }));
+  }
+  return 0;
+}
@@ -0,0 +1,60 @@
+#include <cstdio>  // printf
+#include <random>
+
+#include "bench.hpp"
+
+#include "linked_list.hpp"
+#include "unrolled_linked_list.hpp"
+
+using namespace itis;
+
+// кол-во обращений по случайному индексу в одном замере
+static constexpr int kNumRandomAccesses = 1000;
+
+// LinkedList обходит узлы по одному на каждое обращение: ограничиваем размер, чтобы замер завершался
+static constexpr long long kMaxLinkedListElements = 100'000;
+
+template<typename List>
+static void run(long long num_elements) {
+  List list;
+  for (long long index = 0; index < num_elements; index++) {
+    // искомый элемент (BEAUTIFUL_FLOWERS) отсутствует: поиск проходит весь список
+    list.Add(static_cast<Element>(index % 4));
+  }
+
+  bench::report("  IndexOf (not found)", num_elements, bench::measure_ms([&] {
+    bench::do_not_optimize(list.IndexOf(Element::BEAUTIFUL_FLOWERS));
+  }));
+
+  auto engine = std::mt19937(42);
+  auto index_dist = std::uniform_int_distribution<int>(0, static_cast<int>(num_elements) - 1);
+
+  bench::report("  Get (random index)", kNumRandomAccesses, bench::measure_ms([&] {
+    for (int access = 0; access < kNumRandomAccesses; access++) {
+      bench::do_not_optimize(list.Get(index_dist(engine)));
+    }
+  }));
+
+  bench::report("  Insert + Remove (random index)", kNumRandomAccesses, bench::measure_ms([&] {
+    for (int access = 0; access < kNumRandomAccesses; access++) {
+      const int index = index_dist(engine);
+      list.Insert(index, Element::SECRET_BOX);
+      bench::do_not_optimize(list.Remove(index));
+    }
+  }));
+}
+
+int main(int argc, char **argv) {
+  for (const long long n : bench::sizes(argc, argv, 1'000'000)) {
+    std::printf("n = %lld\n", n);
+
+    if (n <= kMaxLinkedListElements) {
+      std::printf("LinkedList:\n");
+      run<LinkedList>(n);
+    }
+
+    std::printf("UnrolledLinkedList:\n");
+    run<UnrolledLinkedList>(n);
+  }
+  return 0;
+}
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <memory_resource>
+#include <ostream>
+#include <vector>
+
+#include "element.hpp"        // Element
+#include "growth_policy.hpp"  // GrowthPolicy
+
+namespace itis {
+
+/**
+ * Структура данных "двусторонняя очередь на кольцевом буфере".
+ *
+ * Интерфейс совпадает с ArrayList (Get, Set, Insert, Remove, IndexOf, ...),
+ * но элементы хранятся в кольцевом буфере: начало очереди (head) может находиться в любой ячейке,
+ * а элементы, не поместившиеся до конца буфера, продолжаются с его начала.
+ * Поэтому добавление и удаление с обоих концов ~ O(1), без сдвига остальных элементов.
+ *
+ * Пример:
+ * [3 4 x x x 1 2]
+ * head = 5, size = 4, логический порядок: {1, 2, 3, 4}
+ * x - ячейки памяти под элементы (Element::UNINITIALIZED)
+ *
+ * Вставка и удаление в середине сдвигают элементы в сторону ближайшего конца: ~ O(min(index, n - index)).
+ */
+struct ArrayDeque {
+ public:
+  // константы структуры
+  static constexpr int kInitCapacity = 10;          // изначальная емкость буфера
+  static constexpr int kNotFoundElementIndex = -1;  // индекс ненайденного элемента
+
+ private:
+  // поля структуры
+  int size_{0};             // размер (кол-во реальных элементов в очереди)
+  int capacity_{0};         // емкость (кол-во ячеек кольцевого буфера)
+  int head_{0};             // индекс ячейки буфера с первым элементом очереди
+  Element *data_{nullptr};  // указатель на начало кольцевого буфера
+
+  // стратегия расширения емкости
+  GrowthPolicy growth_policy_{GrowthPolicy::Geometric()};
+
+  // источник памяти под элементы (по умолчанию: глобальная куча через new/delete)
+  std::pmr::memory_resource *resource_{std::pmr::get_default_resource()};
+
+ public:
+  // конструктор по умолчанию
+  ArrayDeque();
+
+  /**
+   * Создание очереди определенной емкости.
+   *
+   * Выделенные ячейки буфера инициализируются значением Element::UNINITIALIZED.
+   *
+   * @param capacity - начальная емкость буфера
+   * @param growth_policy - стратегия расширения емкости
+   * @param resource - источник памяти
+   * @throws invalid_argument при указании неположительной емкости или передаче nullptr
+   */
+  explicit ArrayDeque(int capacity,
+                      GrowthPolicy growth_policy = GrowthPolicy::Geometric(),
+                      std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  // копирование запрещено, используйте Clone()
+  ArrayDeque(const ArrayDeque &) = delete;
+  ArrayDeque &operator=(const ArrayDeque &) = delete;
+
+  // перемещение ~ O(1), перемещенная очередь остается пустой
+  ArrayDeque(ArrayDeque &&other) noexcept;
+  ArrayDeque &operator=(ArrayDeque &&other) noexcept;
+
+  // деструктор
+  virtual ~ArrayDeque();
+
+  void Swap(ArrayDeque &other) noexcept;
+
+  // глубокая копия ~ O(n), элементы копии начинаются с нулевой ячейки буфера
+  ArrayDeque Clone() const;
+
+  /**
+   * Добавление элемента в конец очереди ~ O(1)/O(n).
+   *
+   * @param e - значение элемента
+   */
+  void Add(Element e);
+
+  // то же, что и Add
+  void AddLast(Element e);
+
+  /**
+   * Добавление элемента в начало очереди ~ O(1)/O(n).
+   *
+   * [x x 1 2 x] => add_first(0) => [x 0 1 2 x], head: 2 => 1
+   *
+   * @param e - значение элемента
+   */
+  void AddFirst(Element e);
+
+  /**
+   * Вставка элемента по индексу ~ O(min(index, n - index)).
+   *
+   * Элементы сдвигаются в сторону ближайшего конца очереди:
+   * при index < n / 2 элементы [0, index) сдвигаются влево (head уменьшается),
+   * иначе элементы [index, n) сдвигаются вправо.
+   *
+   * @param index - позиция для вставки элемента
+   * @param e - значение элемента
+   *
+   * @throws out_of_range при передаче индекса за пределами очереди
+   */
+  void Insert(int index, Element e);
+
+  /**
+   * Изменение значения элемента по индексу ~ O(1).
+   *
+   * @param index - индекс изменяемого элемента
+   * @param value - новое значение элемента
+   *
+   * @throws out_of_range при передаче индекса за пределами очереди
+   */
+  void Set(int index, Element value);
+
+  /**
+   * Удаление элемента по индексу ~ O(min(index, n - index)).
+   *
+   * Элементы сдвигаются со стороны ближайшего конца очереди,
+   * освободившаяся ячейка инициализируется значением Element::UNINITIALIZED.
+   *
+   * @param index - индекс удаляемого элемента
+   * @return значение удаленного элемента
+   *
+   * @throws out_of_range при передаче индекса за пределами очереди
+   */
+  Element Remove(int index);
+
+  /**
+   * Удаление первого / последнего элемента очереди ~ O(1).
+   *
+   * @return значение удаленного элемента
+   *
+   * @throws out_of_range при пустой очереди
+   */
+  Element RemoveFirst();
+
+  Element RemoveLast();
+
+  /**
+   * Очистка очереди ~ O(n).
+   *
+   * Емкость остается прежней, все освободившиеся ячейки устанавливаются в значение Element::UNINITIALIZED.
+   */
+  void Clear();
+
+  /**
+   * Получение элемента по индексу ~ O(1).
+   *
+   * @param index - индекс элемента (отсчитывается от начала очереди)
+   * @return значение элемента по индексу
+   *
+   * @throws out_of_range при передаче индекса за пределами очереди
+   */
+  Element Get(int index) const;
+
+  // первый / последний элемент очереди ~ O(1), out_of_range при пустой очереди
+  Element GetFirst() const;
+
+  Element GetLast() const;
+
+  /**
+   * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+   *
+   * Занятая часть буфера состоит не более чем из двух непрерывных участков,
+   * каждый из которых просматривается векторным поиском (как в ArrayList).
+   *
+   * @param e - значение элемента
+   * @return индекс элемента или -1 при остутствии элемента в очереди
+   */
+  int IndexOf(Element e) const;
+
+  int LastIndexOf(Element e) const;
+
+  bool Contains(Element e) const;
+
+  int Count(Element e) const;
+
+  int GetSize() const;
+
+  int GetCapacity() const;
+
+  bool IsEmpty() const;
+
+  GrowthPolicy GetGrowthPolicy() const;
+
+  void SetGrowthPolicy(GrowthPolicy growth_policy);
+
+  std::pmr::memory_resource *GetMemoryResource() const;
+
+ private:
+
+  // индекс ячейки буфера, в которой находится элемент с логическим индексом index (0 <= index < capacity)
+  int physical(int index) const;
+
+  // расширение емкости (при необходимости) до вместимости не менее min_capacity
+  void ensure_capacity(int min_capacity);
+
+  /**
+   * Увеличение емкости буфера ~ O(n).
+   * Элементы переносятся в новый буфер по порядку, начиная с нулевой ячейки (head = 0).
+   *
+   * @param new_capacity - новая емкость буфера (должна быть больше предыдущей)
+   */
+  void resize(int new_capacity);
+
+ public:
+  // необходимо для тестирования: ячейки буфера сравниваются в логическом порядке (начиная с head)
+  friend std::ostream &operator<<(std::ostream &, const ArrayDeque &);
+  friend bool operator==(const ArrayDeque &, const std::vector<Element> &);
+};
+
+inline void swap(ArrayDeque &lhs, ArrayDeque &rhs) noexcept {
+  lhs.Swap(rhs);
+}
+
+}  // namespace itis
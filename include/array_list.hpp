@@ -1,12 +1,89 @@
 #pragma once
 
+#include <memory_resource>
 #include <ostream>
 #include <vector>
 
-#include "element.hpp"  // Element
+#include "element.hpp"                  // Element
+#include "growth_policy.hpp"            // GrowthPolicy
+#include "private/element_counts.hpp"   // ElementCounts
+#include "private/shared_elements.hpp"  // SharedElements
+#include "thread_pool.hpp"              // ThreadPool
 
 namespace itis {
 
+/**
+ * Неизменяемый снимок массива ArrayList (см. ArrayList::Snapshot).
+ *
+ * Разделяет буфер элементов с массивом через счетчик владельцев: создание и копирование снимка ~ O(1).
+ * Массив копирует буфер только при первом изменении после создания снимка (копирование при записи),
+ * поэтому содержимое снимка не меняется, и снимок читается без блокировок, в том числе из других потоков.
+ * Прим. снимок создается в потоке, изменяющем массив; копировать, читать и уничтожать его можно в любом потоке.
+ */
+struct ArrayListSnapshot {
+ private:
+  // поля структуры
+  internal::SharedElements *shared_{nullptr};  // блок управления буфером (nullptr - пустой снимок)
+  const Element *data_{nullptr};               // начало буфера элементов
+  int size_{0};                                // кол-во элементов на момент создания снимка
+
+  friend struct ArrayList;
+
+  // создание снимка с регистрацией нового владельца буфера
+  ArrayListSnapshot(internal::SharedElements *shared, const Element *data, int size);
+
+ public:
+  // пустой снимок
+  ArrayListSnapshot() = default;
+
+  // копирование снимка ~ O(1): копия разделяет тот же буфер
+  ArrayListSnapshot(const ArrayListSnapshot &other);
+  ArrayListSnapshot &operator=(const ArrayListSnapshot &other);
+
+  ArrayListSnapshot(ArrayListSnapshot &&other) noexcept;
+  ArrayListSnapshot &operator=(ArrayListSnapshot &&other) noexcept;
+
+  // деструктор (последний владелец освобождает буфер)
+  ~ArrayListSnapshot();
+
+  void Swap(ArrayListSnapshot &other) noexcept;
+
+  /**
+   * Получение элемента снимка по индексу ~ O(1).
+   *
+   * @param index - индекс элемента
+   * @return значение элемента по индексу
+   *
+   * @throws out_of_range при передаче индекса за пределами снимка
+   */
+  Element Get(int index) const;
+
+  int IndexOf(Element e) const;
+
+  int LastIndexOf(Element e) const;
+
+  bool Contains(Element e) const;
+
+  int Count(Element e) const;
+
+  int GetSize() const;
+
+  bool IsEmpty() const;
+
+  // элементы снимка для range-based for и алгоритмов STL
+  const Element *begin() const;
+
+  const Element *end() const;
+
+  // необходимо для тестирования
+  friend bool operator==(const ArrayListSnapshot &, const std::vector<Element> &);
+};
+
+// обмен содержимым снимков (для std::swap и алгоритмов STL)
+inline void swap(ArrayListSnapshot &lhs, ArrayListSnapshot &rhs) noexcept {
+  lhs.Swap(rhs);
+}
+
 /**
  * Структура данных "массив переменной длины".
  *
@@ -27,12 +104,41 @@ struct ArrayList {
   static constexpr int kCapacityGrowthCoefficient = 10;  // коэфициент увеличения размера массива [МОЖНО ИЗМЕНЯТЬ]
   static constexpr int kNotFoundElementIndex = -1;       // индекс ненайденного элемента в массиве
 
+  /**
+   * Режим инициализации свободных ячеек массива.
+   *
+   * EAGER - ячейки заполняются значением Element::UNINITIALIZED сразу при выделении памяти;
+   * LAZY  - ячейки за пределами размера не заполняются при выделении памяти (страницы памяти не затрагиваются),
+   *         а заполняются только при наблюдении (operator<<, operator==).
+   */
+  enum class FillMode { EAGER, LAZY };
+
  private:
   // поля структуры
   int size_{0};             // размер (кол-во реальных элементов в массиве)
   int capacity_{0};         // емкость (кол-во ячеек памяти под элементы в массиве)
   Element *data_{nullptr};  // указатель на начало непрерывного блока памяти под элементы
 
+  // стратегия расширения емкости (по умолчанию: capacity + kCapacityGrowthCoefficient)
+  GrowthPolicy growth_policy_{GrowthPolicy::Additive(kCapacityGrowthCoefficient)};
+
+  // источник памяти под элементы (по умолчанию: глобальная куча через new/delete)
+  std::pmr::memory_resource *resource_{std::pmr::get_default_resource()};
+
+  // счетчики вхождений элементов (режим статистики, по умолчанию выключен)
+  internal::ElementCounts counts_;
+
+  // режим инициализации свободных ячеек
+  FillMode fill_mode_{FillMode::EAGER};
+
+  // кол-во заполненных ячеек с начала блока: [0, filled) содержат элементы или Element::UNINITIALIZED,
+  // в режиме EAGER всегда равно емкости, в режиме LAZY не меньше размера
+  mutable int filled_{0};
+
+  // блок управления буфером, разделяемым со снимками (nullptr - массив владеет буфером единолично)
+  // Прим. создается в константном методе Snapshot, поэтому mutable
+  mutable internal::SharedElements *shared_{nullptr};
+
  public:
   // конструктор по умолчанию
   ArrayList();
@@ -48,9 +154,109 @@ struct ArrayList {
    */
   explicit ArrayList(int capacity);
 
+  /**
+   * Создание массива определенной емкости с указанной стратегией расширения.
+   *
+   * Пример: ArrayList(kInitCapacity, GrowthPolicy::Geometric(1.5))
+   *
+   * @param capacity - начальная емкость массива
+   * @param growth_policy - стратегия расширения емкости
+   * @throws invalid_argument при указании неположительной емкости
+   */
+  ArrayList(int capacity, GrowthPolicy growth_policy);
+
+  /**
+   * Создание массива, выделяющего память через указанный источник памяти (аллокатор).
+   *
+   * Все выделения и освобождения памяти под элементы (в т.ч. при расширении) проходят через resource.
+   * Источник памяти должен "пережить" массив.
+   * Пример: std::pmr::monotonic_buffer_resource arena; ArrayList list(&arena);
+   *
+   * @param resource - источник памяти
+   * @throws invalid_argument при передаче nullptr
+   */
+  explicit ArrayList(std::pmr::memory_resource *resource);
+
+  /**
+   * @param capacity - начальная емкость массива
+   * @param resource - источник памяти
+   * @throws invalid_argument при указании неположительной емкости или передаче nullptr
+   */
+  ArrayList(int capacity, std::pmr::memory_resource *resource);
+
+  /**
+   * @param capacity - начальная емкость массива
+   * @param growth_policy - стратегия расширения емкости
+   * @param resource - источник памяти
+   * @throws invalid_argument при указании неположительной емкости или передаче nullptr
+   */
+  ArrayList(int capacity, GrowthPolicy growth_policy, std::pmr::memory_resource *resource);
+
+  /**
+   * Создание массива с указанным режимом инициализации свободных ячеек.
+   *
+   * В режиме FillMode::LAZY резервирование большой емкости почти бесплатно:
+   * память выделяется, но не заполняется, и страницы подгружаются ОС по мере записи элементов.
+   * Пример: ArrayList(1 << 28, ArrayList::FillMode::LAZY) ~ 1 ГБ без обхода памяти.
+   *
+   * @param capacity - начальная емкость массива
+   * @param fill_mode - режим инициализации свободных ячеек
+   * @param growth_policy - стратегия расширения емкости
+   * @param resource - источник памяти
+   * @throws invalid_argument при указании неположительной емкости или передаче nullptr
+   */
+  ArrayList(int capacity,
+            FillMode fill_mode,
+            GrowthPolicy growth_policy = GrowthPolicy::Additive(kCapacityGrowthCoefficient),
+            std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  // копирование запрещено (во избежание двойного освобождения памяти), используйте Clone()
+  ArrayList(const ArrayList &) = delete;
+  ArrayList &operator=(const ArrayList &) = delete;
+
+  /**
+   * Перемещение массива ~ O(1).
+   *
+   * Забирает блок памяти у другого массива без копирования элементов.
+   * Перемещенный массив остается пустым: {size = 0, capacity = 0, data = nullptr}.
+   * Источник памяти перемещается вместе с блоком памяти.
+   *
+   * @param other - перемещаемый массив
+   */
+  ArrayList(ArrayList &&other) noexcept;
+  ArrayList &operator=(ArrayList &&other) noexcept;
+
   // деструктор
   virtual ~ArrayList();
 
+  /**
+   * Обмен содержимым с другим массивом ~ O(1).
+   *
+   * @param other - массив для обмена
+   */
+  void Swap(ArrayList &other) noexcept;
+
+  /**
+   * Глубокая копия массива ~ O(n).
+   *
+   * Копия имеет те же элементы, емкость, стратегию расширения и источник памяти.
+   *
+   * @return копия массива
+   */
+  ArrayList Clone() const;
+
+  /**
+   * Неизменяемый снимок текущего содержимого массива ~ O(1).
+   *
+   * Снимок разделяет буфер с массивом: элементы не копируются.
+   * Первое изменение массива после создания снимка копирует буфер ~ O(n) (копирование при записи),
+   * последующие изменения идут без копирования, пока не будет создан новый снимок.
+   * Если к моменту изменения все снимки уничтожены, буфер снова принадлежит массиву и не копируется.
+   *
+   * @return снимок элементов [0, size)
+   */
+  ArrayListSnapshot Snapshot() const;
+
   /**
    * Добавление элемента в конец массива ~ O(1)/O(n).
    *
@@ -77,6 +283,35 @@ struct ArrayList {
    */
   void Insert(int index, Element e);
 
+  /**
+   * Добавление последовательности элементов в конец массива ~ O(k)/O(n + k).
+   *
+   * Емкость расширяется не более одного раза, элементы копируются одним блоком.
+   * [1 2 x] => add_range({3, 4, 5}) => [1 2 3 4 5 x x]
+   *
+   * @param elements - указатель на начало последовательности (может указывать внутрь этого же массива)
+   * @param count - кол-во добавляемых элементов
+   *
+   * @throws invalid_argument при отрицательном кол-ве элементов
+   */
+  void AddRange(const Element *elements, int count);
+
+  /**
+   * Вставка последовательности элементов [first, last) в массив по индексу ~ O(n + k).
+   *
+   * Элементы справа от позиции вставки сдвигаются на k позиций вправо одним блоком (memmove),
+   * емкость расширяется не более одного раза.
+   * [1 2 3 x x] => insert_range(1, {7, 8}) => [1 7 8 2 3]
+   *
+   * @param index - позиция для вставки первого элемента
+   * @param first - указатель на первый вставляемый элемент
+   * @param last - указатель за последним вставляемым элементом
+   *
+   * @throws out_of_range при передаче индекса за пределами массива
+   * @throws invalid_argument при first > last
+   */
+  void InsertRange(int index, const Element *first, const Element *last);
+
   /**
    * Изменение значения элемента массива по индексу ~ O(1).
    *
@@ -102,6 +337,36 @@ struct ArrayList {
    */
   Element Remove(int index);
 
+  /**
+   * Удаление элементов массива в диапазоне индексов [from, to) ~ O(n).
+   *
+   * Элементы справа от диапазона сдвигаются влево одним блоком (memmove).
+   * Освободившиеся ячейки инициализируются значением Element::UNINITIALIZED.
+   * [1 2 3 4 5] => remove_range(1, 3) => [1 4 5 x x]
+   *
+   * @param from - индекс первого удаляемого элемента (включительно)
+   * @param to - индекс за последним удаляемым элементом (не включительно)
+   *
+   * @throws out_of_range при выходе диапазона за пределы массива
+   */
+  void RemoveRange(int from, int to);
+
+  /**
+   * Сортировка элементов массива по возрастанию значений Element ~ O(n), без выделения памяти.
+   *
+   * Значений Element всего kNumElementValues, поэтому используется сортировка подсчетом:
+   * проход по массиву строит гистограмму значений (в режиме статистики берется готовая),
+   * затем массив заполняется значениями подряд (std::fill - векторизуемое заполнение).
+   * [2 0 1 0] => sort => [0 0 1 2]
+   */
+  void Sort();
+
+  /**
+   * Устойчивая сортировка элементов массива ~ O(n).
+   * Прим. равные элементы массива неразличимы, поэтому сортировка подсчетом (Sort) уже устойчива.
+   */
+  void StableSort();
+
   /**
    * Очистка массива ~ O(n).
    *
@@ -123,29 +388,177 @@ struct ArrayList {
 
   /**
    * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+   * Прим. в режиме статистики отсутствующий элемент определяется за O(1).
+   *
+   * Используются векторные инструкции (SSE2/AVX2/AVX-512), выбираемые по возможностям процессора.
    *
    * @param e - значение элемента
    * @return индекс элемента или -1 при остутствии элемента в массиве
    */
   int IndexOf(Element e) const;
 
+  /**
+   * Поиск индекса последнего вхождения элемента с указанным значением ~ O(n).
+   *
+   * @param e - значение элемента
+   * @return индекс элемента или -1 при остутствии элемента в массиве
+   */
+  int LastIndexOf(Element e) const;
+
   bool Contains(Element e) const;
 
+  /**
+   * Подсчет кол-ва элементов с указанным значением ~ O(n).
+   * Прим. в режиме статистики (и для Contains) ~ O(1).
+   *
+   * @param e - значение элемента
+   * @return кол-во вхождений элемента в массив
+   */
+  int Count(Element e) const;
+
+  /**
+   * Параллельный подсчет кол-ва элементов с указанным значением ~ O(n / p).
+   * Прим. в режиме статистики ~ O(1) без обращения к пулу.
+   *
+   * Части массива по ThreadPool::kDefaultGrainSize элементов обрабатываются потоками пула (векторный подсчет),
+   * частичные суммы складываются.
+   *
+   * @param e - значение элемента
+   * @param pool - пул потоков
+   * @return кол-во вхождений элемента в массив
+   */
+  int ParallelCount(Element e, ThreadPool &pool = ThreadPool::Default()) const;
+
+  /**
+   * Параллельный поиск индекса первого вхождения элемента ~ O(n / p).
+   *
+   * Части массива просматриваются потоками пула; найденный индекс публикуется как общий минимум,
+   * и части, начинающиеся правее уже найденного индекса, пропускаются (досрочная отмена).
+   *
+   * @param e - значение элемента
+   * @param pool - пул потоков
+   * @return индекс элемента или -1 при остутствии элемента в массиве
+   */
+  int ParallelIndexOf(Element e, ThreadPool &pool = ThreadPool::Default()) const;
+
+  /**
+   * Параллельная замена всех элементов со значением old_value на new_value ~ O(n / p).
+   * Части и блоки замены выровнены по кэш-линиям: соседние части не пишут в одну линию.
+   *
+   * @param old_value - заменяемое значение
+   * @param new_value - новое значение
+   * @param pool - пул потоков
+   * @return кол-во замененных элементов
+   */
+  int ParallelReplace(Element old_value, Element new_value, ThreadPool &pool = ThreadPool::Default());
+
+  /**
+   * Параллельный обход элементов массива ~ O(n / p): visitor(index, e) для каждого элемента.
+   *
+   * Порядок вызовов не задан, visitor вызывается одновременно из нескольких потоков
+   * (для разных индексов) и не должен изменять массив.
+   * Пример: list.ParallelForEach([&](int index, Element e) { output[index] = transform(e); });
+   *
+   * @param visitor - функция, принимающая индекс и значение элемента
+   * @param pool - пул потоков
+   */
+  template<typename Visitor>
+  void ParallelForEach(Visitor &&visitor, ThreadPool &pool = ThreadPool::Default()) const;
+
   int GetSize() const;
 
   int GetCapacity() const;
 
   bool IsEmpty() const;
 
+  GrowthPolicy GetGrowthPolicy() const;
+
+  /**
+   * Изменение стратегии расширения емкости ~ O(1).
+   * Текущая емкость и элементы массива не изменяются.
+   *
+   * @param growth_policy - новая стратегия расширения
+   */
+  void SetGrowthPolicy(GrowthPolicy growth_policy);
+
+  std::pmr::memory_resource *GetMemoryResource() const;
+
+  FillMode GetFillMode() const;
+
+  /**
+   * Резервирование емкости массива ~ O(1)/O(n).
+   *
+   * Емкость становится не меньше указанной (стратегия расширения не применяется).
+   * В режиме FillMode::LAZY зарезервированные ячейки не заполняются.
+   *
+   * @param capacity - минимальная емкость массива
+   */
+  void Reserve(int capacity);
+
+  /**
+   * Включение режима статистики ~ O(n).
+   *
+   * В режиме статистики массив поддерживает кол-во вхождений каждого значения Element
+   * при каждом изменении (Add, Insert, Set, Remove, Clear и их групповых версиях),
+   * за счет чего Count и Contains выполняются за O(1), а IndexOf сразу завершается для отсутствующих элементов.
+   * Цена: небольшие накладные расходы на каждое изменение массива.
+   */
+  void EnableElementCounts();
+
+  // выключение режима статистики ~ O(1)
+  void DisableElementCounts();
+
+  bool HasElementCounts() const;
+
  private:
 
+  /**
+   * Выделение блока памяти под элементы через источник памяти ~ O(1).
+   *
+   * @param capacity - кол-во ячеек
+   * @return указатель на начало блока (ячейки не инициализированы)
+   */
+  Element *allocate(int capacity) const;
+
+  /**
+   * Освобождение блока памяти, выделенного allocate ~ O(1).
+   *
+   * @param data - указатель на начало блока (может быть nullptr)
+   * @param capacity - кол-во ячеек в блоке
+   */
+  void deallocate(Element *data, int capacity) const;
+
+  /**
+   * Расширение емкости массива согласно стратегии расширения ~ O(n).
+   *
+   * @param min_capacity - минимально необходимая емкость (должна быть больше текущей)
+   */
+  void grow(int min_capacity);
+
+  /**
+   * Расширение емкости массива (при необходимости) до вместимости не менее min_capacity ~ O(1)/O(n).
+   *
+   * @param min_capacity - минимально необходимая емкость
+   */
+  void ensure_capacity(int min_capacity);
+
+  // заполнение незаполненных ячеек (режим FillMode::LAZY) значением Element::UNINITIALIZED ~ O(capacity - filled)
+  void materialize() const;
+
   /**
    * Увеличение емкости массива ~ O(n).
+   * Прим. в режиме FillMode::LAZY копируются только элементы, новые ячейки не заполняются.
    *
    * @param new_capacity - новая емкость массива (должна быть больше предыдущей)
    */
   void resize(int new_capacity);
 
+  // отделение от снимков перед изменением: копия буфера, если его еще читают снимки ~ O(1)/O(n)
+  void detach();
+
+  // освобождение буфера (или отказ от владения им, если буфер разделяется со снимками) ~ O(1)
+  void release_data();
+
  public:
   // необходимо для тестирования
   ArrayList(Element *data, int size, int capacity);
@@ -153,6 +566,21 @@ struct ArrayList {
   friend bool operator==(const ArrayList &, const std::vector<Element> &);
 };
 
+template<typename Visitor>
+void ArrayList::ParallelForEach(Visitor &&visitor, ThreadPool &pool) const {
+  const Element *data = data_;
+  pool.ParallelFor(0, size_, ThreadPool::kDefaultGrainSize, [data, &visitor](int begin, int end) {
+    for (int index = begin; index < end; index++) {
+      visitor(index, data[index]);
+    }
+  });
+}
+
+// обмен содержимым массивов (для std::swap и алгоритмов STL)
+inline void swap(ArrayList &lhs, ArrayList &rhs) noexcept {
+  lhs.Swap(rhs);
+}
+
 // внутренние проверки
 static_assert(ArrayList::kInitCapacity > 0, "ArrayList initial capacity must be positive");
 static_assert(ArrayList::kCapacityGrowthCoefficient > 1, "ArrayList growth coefficient must be greater than 1");
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <cstdint>  // uint8_t, uint32_t
+#include <memory_resource>
+#include <ostream>
+#include <vector>
+
+#include "element.hpp"        // Element
+#include "growth_policy.hpp"  // GrowthPolicy
+
+namespace itis {
+
+/**
+ * Структура данных "компактный связный список" (связный список на массивах).
+ *
+ * Интерфейс совпадает с LinkedList, но узлы хранятся не в куче по отдельности,
+ * а в ячейках (слотах) одного непрерывного блока памяти:
+ * вместо указателя на следующий узел (8 байт) хранится индекс следующего слота (uint32_t, 4 байта),
+ * вместо Element (4 байта) - его значение в одном байте (uint8_t).
+ * Итого 5 байт на узел вместо 24 байт узла Node (без учета служебных данных malloc на каждый узел).
+ *
+ * Блок: [next[0] ... next[capacity - 1] | data[0] ... data[capacity - 1]]
+ * Индексы не зависят от адреса блока, поэтому блок можно копировать memcpy (Clone) или сохранять целиком.
+ *
+ * Пример (слоты 0..3, список 7 -> 5 -> 9, слот 1 свободен):
+ * next: [2, x, null, 0], data: [5, x, 9, 7], head = 3, tail = 2
+ *
+ * Освобожденные слоты образуют список свободных слотов (free list) и выдаются повторно в первую очередь.
+ * После вставок в середину и удалений порядок слотов перестает совпадать с порядком списка,
+ * Compact() переставляет узлы так, что i-й элемент хранится в i-м слоте:
+ * обход становится последовательным проходом по памяти, а доступ по индексу ~ O(1) до следующего изменения порядка.
+ */
+struct CompactLinkedList {
+ public:
+  static constexpr int kNotFoundElementIndex = -1;                  // индекс ненайденного элемента в списке
+  static constexpr int kInitCapacity = 16;                          // емкость блока при первом добавлении
+  static constexpr std::uint32_t kNullIndex = UINT32_MAX;           // индекс "нулевого" слота (аналог nullptr)
+  static constexpr int kBytesPerNode = sizeof(std::uint32_t) + sizeof(std::uint8_t);  // размер узла в блоке
+
+ private:
+  // поля структуры
+  int size_{0};                           // кол-во элементов в списке
+  int capacity_{0};                       // кол-во слотов в блоке
+  int num_slots_used_{0};                 // кол-во слотов, выданных хотя бы раз (слоты [num_slots_used, capacity) не тронуты)
+  std::uint32_t head_{kNullIndex};        // слот первого узла
+  std::uint32_t tail_{kNullIndex};        // слот последнего узла
+  std::uint32_t free_list_{kNullIndex};   // первый свободный слот (свободные слоты связаны через next)
+  bool compact_{true};                    // i-й элемент списка хранится в i-м слоте
+
+  std::uint32_t *next_{nullptr};  // начало блока: индексы следующих слотов
+  std::uint8_t *data_{nullptr};   // значения элементов (в том же блоке сразу за индексами)
+
+  // стратегия расширения емкости блока
+  GrowthPolicy growth_policy_{GrowthPolicy::Geometric()};
+
+  // источник памяти под блок (по умолчанию: глобальная куча через new/delete)
+  std::pmr::memory_resource *resource_{std::pmr::get_default_resource()};
+
+ public:
+  // конструктор по умолчанию (блок выделяется при первом добавлении)
+  CompactLinkedList() = default;
+
+  /**
+   * Создание списка с указанной стратегией расширения блока и источником памяти.
+   *
+   * @param growth_policy - стратегия расширения емкости блока
+   * @param resource - источник памяти
+   * @throws invalid_argument при передаче nullptr
+   */
+  explicit CompactLinkedList(GrowthPolicy growth_policy,
+                             std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  // копирование запрещено, используйте Clone()
+  CompactLinkedList(const CompactLinkedList &) = delete;
+  CompactLinkedList &operator=(const CompactLinkedList &) = delete;
+
+  // перемещение ~ O(1), перемещенный список остается пустым
+  CompactLinkedList(CompactLinkedList &&other) noexcept;
+  CompactLinkedList &operator=(CompactLinkedList &&other) noexcept;
+
+  // деструктор
+  virtual ~CompactLinkedList();
+
+  void Swap(CompactLinkedList &other) noexcept;
+
+  // глубокая копия ~ O(capacity): блок копируется целиком (memcpy), порядок слотов сохраняется
+  CompactLinkedList Clone() const;
+
+  /**
+   * Добавление элемента в конец списка ~ O(1) (амортизированно).
+   *
+   * Узел занимает свободный слот или следующий нетронутый слот блока, при заполненном блоке блок расширяется.
+   *
+   * @param e - значение элемента
+   */
+  void Add(Element e);
+
+  /**
+   * Вставка элемента в список по индексу ~ O(n).
+   * Прим. вставка в начало и конец списка ~ O(1).
+   *
+   * @param index - позиция для вставки элемента
+   * @param e - значение элемента
+   *
+   * @throws out_of_range при передаче индекса за пределами списка
+   */
+  void Insert(int index, Element e);
+
+  /**
+   * Изменение значения элемента списка по индексу ~ O(n), после Compact() ~ O(1).
+   *
+   * @throws out_of_range при передаче индекса за пределами списка
+   */
+  void Set(int index, Element e);
+
+  /**
+   * Удаление элемента списка по индексу ~ O(n).
+   * Прим. удаление с начала списка ~ O(1).
+   *
+   * Слот удаленного узла попадает в список свободных слотов.
+   *
+   * @param index - индекс удаляемого элемента
+   * @return значение удаленного элемента
+   *
+   * @throws out_of_range при передаче индекса за пределами списка
+   */
+  Element Remove(int index);
+
+  // удаление всех элементов списка ~ O(1), блок сохраняется для повторного использования
+  void Clear();
+
+  /**
+   * Получение элемента списка по индексу ~ O(n), после Compact() ~ O(1).
+   *
+   * @throws out_of_range при передаче индекса за пределами списка
+   */
+  Element Get(int index) const;
+
+  /**
+   * Перестановка узлов в порядке списка ~ O(n).
+   *
+   * После вызова i-й элемент списка хранится в i-м слоте блока, список свободных слотов пуст.
+   * Обход списка становится последовательным проходом по памяти,
+   * а доступ по индексу (Get, Set) выполняется за O(1), пока порядок слотов не нарушен
+   * вставкой не в конец списка или удалением не с конца списка.
+   */
+  void Compact();
+
+  // true, если i-й элемент списка хранится в i-м слоте (доступ по индексу ~ O(1))
+  bool IsCompact() const;
+
+  // поиск индекса первого вхождения элемента ~ O(n), -1 при отсутствии элемента в списке
+  int IndexOf(Element e) const;
+
+  bool Contains(Element e) const;
+
+  int Count(Element e) const;
+
+  int GetSize() const;
+
+  // кол-во слотов в блоке
+  int GetCapacity() const;
+
+  bool IsEmpty() const;
+
+  Element tail() const;
+
+  Element head() const;
+
+  std::pmr::memory_resource *GetMemoryResource() const;
+
+ private:
+
+  // выделение блока под capacity слотов
+  std::uint32_t *allocate(int capacity) const;
+
+  // высвобождение блока под capacity слотов
+  void deallocate(std::uint32_t *block, int capacity) const;
+
+  // расширение блока до new_capacity слотов с сохранением номеров слотов ~ O(capacity)
+  void resize(int new_capacity);
+
+  // выдача слота под новый узел (со значением e и следующим слотом next) ~ O(1) (амортизированно)
+  std::uint32_t allocate_slot(Element e, std::uint32_t next);
+
+  // возврат слота в список свободных слотов ~ O(1)
+  void free_slot(std::uint32_t slot);
+
+  /**
+   * Поиск слота узла по индексу ~ O(n).
+   * Прим. последний узел и узлы компактного списка ~ O(1).
+   *
+   * @param index - индекс элемента (0 <= index < size)
+   * @return номер слота
+   */
+  std::uint32_t find_slot(int index) const;
+
+ public:
+  // необходимо для тестирования
+  explicit CompactLinkedList(const std::vector<Element> &);
+  friend std::ostream &operator<<(std::ostream &, const CompactLinkedList &);
+  friend bool operator==(const CompactLinkedList &, const std::vector<Element> &);
+};
+
+inline void swap(CompactLinkedList &lhs, CompactLinkedList &rhs) noexcept {
+  lhs.Swap(rhs);
+}
+
+}  // namespace itis
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <array>    // array
+#include <atomic>   // atomic
+#include <cstddef>  // size_t
+#include <memory_resource>
+#include <ostream>
+#include <vector>
+
+#include "array_list.hpp"  // ArrayList
+#include "element.hpp"     // Element
+
+namespace itis {
+
+/**
+ * Структура данных "массив с параллельным добавлением" (несколько потоков-производителей).
+ *
+ * Элементы хранятся в сегментах, которые никогда не перемещаются в памяти:
+ * сегмент k вмещает kFirstSegmentCapacity * 2^k элементов, указатели на сегменты лежат в фиксированном каталоге.
+ * Индекс элемента переводится в номер сегмента и смещение в нем сдвигами (без обхода каталога).
+ *
+ * Пример (kFirstSegmentCapacity = 4):
+ * сегмент 0: [0 1 2 3]
+ * сегмент 1: [4 5 6 7 8 9 10 11]
+ * сегмент 2: [12 ... 27]
+ *
+ * Add и AddRange можно вызывать из нескольких потоков одновременно без внешней блокировки:
+ * производитель резервирует ячейки атомарным fetch_add размера и записывает в них элементы,
+ * новый сегмент устанавливается в каталог через compare_exchange.
+ * Get и GetSize можно вызывать параллельно с добавлением: расширение не переносит элементы,
+ * поэтому читатель никогда не видит "оборванный" массив.
+ *
+ * Остальные методы (Clear, перемещение, Swap) требуют, чтобы других потоков, работающих со списком, не было.
+ * После заполнения элементы можно перенести в обычный массив: ToArrayList().
+ */
+struct ConcurrentArrayList {
+ public:
+  // константы структуры
+  static constexpr int kFirstSegmentShift = 6;                            // log2 емкости первого сегмента
+  static constexpr int kFirstSegmentCapacity = 1 << kFirstSegmentShift;   // емкость первого сегмента
+  static constexpr int kMaxSegments = 32 - kFirstSegmentShift;            // сегментов хватает на INT_MAX элементов
+
+ private:
+  using Cell = std::atomic<Element>;
+
+  // поля структуры
+
+  // кол-во зарезервированных ячеек (на отдельной кэш-линии: ее изменяют все производители)
+  alignas(64) std::atomic<long long> size_{0};
+
+  // каталог сегментов (nullptr - сегмент еще не выделен)
+  alignas(64) std::array<std::atomic<Cell *>, kMaxSegments> segments_{};
+
+  // источник памяти под сегменты (должен допускать вызовы из нескольких потоков)
+  std::pmr::memory_resource *resource_{std::pmr::get_default_resource()};
+
+ public:
+  // конструктор по умолчанию
+  ConcurrentArrayList() = default;
+
+  /**
+   * Создание массива, выделяющего память под сегменты через указанный источник памяти.
+   * Прим. источник памяти вызывается из потоков-производителей (подходит синхронизированный источник,
+   * например, стандартный или std::pmr::synchronized_pool_resource).
+   *
+   * @param resource - источник памяти
+   * @throws invalid_argument при передаче nullptr
+   */
+  explicit ConcurrentArrayList(std::pmr::memory_resource *resource);
+
+  // копирование запрещено (во избежание двойного освобождения памяти), используйте Clone()
+  ConcurrentArrayList(const ConcurrentArrayList &) = delete;
+  ConcurrentArrayList &operator=(const ConcurrentArrayList &) = delete;
+
+  /**
+   * Перемещение массива ~ O(кол-во сегментов), не потокобезопасно.
+   * Перемещенный массив остается пустым.
+   *
+   * @param other - перемещаемый массив
+   */
+  ConcurrentArrayList(ConcurrentArrayList &&other) noexcept;
+  ConcurrentArrayList &operator=(ConcurrentArrayList &&other) noexcept;
+
+  // деструктор
+  ~ConcurrentArrayList();
+
+  /**
+   * Обмен содержимым с другим массивом ~ O(кол-во сегментов), не потокобезопасно.
+   *
+   * @param other - массив для обмена
+   */
+  void Swap(ConcurrentArrayList &other) noexcept;
+
+  // глубокая копия массива ~ O(n) (с тем же источником памяти), не потокобезопасно
+  ConcurrentArrayList Clone() const;
+
+  /**
+   * Добавление элемента в конец массива ~ O(1), потокобезопасно.
+   *
+   * Ячейка резервируется атомарным увеличением размера, поэтому элементы разных потоков
+   * располагаются в порядке резервирования, а не в порядке завершения вызовов.
+   *
+   * @param e - значение элемента
+   * @throws length_error при превышении INT_MAX элементов
+   */
+  void Add(Element e);
+
+  /**
+   * Добавление элементов в конец массива ~ O(count), потокобезопасно.
+   *
+   * Все count ячеек резервируются одним fetch_add: элементы диапазона идут в массиве подряд,
+   * а производитель обращается к общему счетчику один раз на диапазон (лучше масштабируется, чем Add).
+   * При превышении INT_MAX резервирование отменяется до записи (элементы не читаются);
+   * пока отмена не выполнена, GetSize в других потоках может учитывать эти ячейки, как и любые еще не записанные.
+   *
+   * @param elements - указатель на первый элемент диапазона
+   * @param count - кол-во элементов
+   * @throws invalid_argument при отрицательном кол-ве элементов
+   * @throws length_error при превышении INT_MAX элементов
+   */
+  void AddRange(const Element *elements, int count);
+
+  /**
+   * Получение элемента по индексу ~ O(1), потокобезопасно.
+   * Прим. ячейка, зарезервированная, но еще не записанная производителем, содержит Element::UNINITIALIZED.
+   *
+   * @param index - индекс элемента
+   * @return значение элемента по индексу
+   *
+   * @throws out_of_range при передаче индекса за пределами массива
+   */
+  Element Get(int index) const;
+
+  /**
+   * Удаление всех элементов и освобождение сегментов ~ O(кол-во сегментов), не потокобезопасно.
+   */
+  void Clear();
+
+  /**
+   * Копирование элементов в обычный массив ~ O(n).
+   * Вызывается после завершения производителей (иначе часть ячеек может быть Element::UNINITIALIZED).
+   *
+   * @return массив с элементами в порядке индексов (с тем же источником памяти)
+   */
+  ArrayList ToArrayList() const;
+
+  // кол-во зарезервированных ячеек (включает ячейки, запись в которые еще не завершена), потокобезопасно
+  int GetSize() const;
+
+  bool IsEmpty() const;
+
+  // суммарная емкость выделенных сегментов
+  int GetCapacity() const;
+
+  std::pmr::memory_resource *GetMemoryResource() const;
+
+ private:
+
+  // емкость сегмента с указанным номером
+  static std::size_t segment_capacity(int segment);
+
+  /**
+   * Получение сегмента по номеру (с выделением и установкой в каталог при отсутствии) ~ O(емкость сегмента).
+   *
+   * Если несколько потоков устанавливают сегмент одновременно, в каталог попадает сегмент первого,
+   * остальные освобождают свои.
+   *
+   * @param segment - номер сегмента
+   * @return указатель на первую ячейку сегмента
+   */
+  Cell *ensure_segment(int segment);
+
+  /**
+   * Запись элементов в зарезервированные ячейки [start, start + count) ~ O(count).
+   * Сегменты выделяются по мере необходимости (ensure_segment): заранее следующий сегмент не выделяется,
+   * поэтому выделенная емкость не превышает 2n + kFirstSegmentCapacity.
+   */
+  void store_range(long long start, const Element *elements, int count);
+
+  // чтение элемента без проверки индекса (nullptr-сегмент читается как Element::UNINITIALIZED)
+  Element load(int index) const;
+
+ public:
+  // необходимо для тестирования
+  explicit ConcurrentArrayList(const std::vector<Element> &);
+  friend std::ostream &operator<<(std::ostream &, const ConcurrentArrayList &);
+  friend bool operator==(const ConcurrentArrayList &, const std::vector<Element> &);
+};
+
+// обмен содержимым массивов (для std::swap и алгоритмов STL)
+inline void swap(ConcurrentArrayList &lhs, ConcurrentArrayList &rhs) noexcept {
+  lhs.Swap(rhs);
+}
+
+}  // namespace itis
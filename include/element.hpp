@@ -12,6 +12,9 @@ enum class Element {
   UNINITIALIZED  // специальное значение, обозначающее отсутствие элемента
 };
 
+// кол-во значений перечисления Element (включая Element::UNINITIALIZED)
+inline constexpr int kNumElementValues = static_cast<int>(Element::UNINITIALIZED) + 1;
+
 // внутренние проверки
 static_assert(static_cast<int>(Element::UNINITIALIZED) == 5, "Enum class Element contains too many values");
 
@@ -0,0 +1,86 @@
+#pragma once
+
+namespace itis {
+
+/**
+ * Стратегия расширения емкости массива.
+ *
+ * По текущей емкости и минимально необходимой емкости вычисляет новую емкость.
+ * Поддерживаются три вида стратегий:
+ *  - аддитивная: capacity + increment (каждое расширение добавляет фиксированное кол-во ячеек);
+ *  - геометрическая: capacity * factor (амортизированная сложность добавления ~ O(1));
+ *  - пользовательская: новая емкость вычисляется переданной функцией.
+ *
+ * Пример (геометрическая, factor = 2):
+ * capacity: 10 => 20 => 40 => 80 ...
+ * При добавлении N элементов выполняется O(log N) расширений и O(N) копирований элементов.
+ */
+struct GrowthPolicy {
+ public:
+  /**
+   * Пользовательская функция расширения.
+   *
+   * @param capacity - текущая емкость массива
+   * @param min_capacity - минимально необходимая емкость (всегда больше текущей)
+   * @return новая емкость массива (результат меньше min_capacity будет увеличен до min_capacity)
+   */
+  using Function = int (*)(int capacity, int min_capacity);
+
+  static constexpr double kDefaultGrowthFactor = 2.0;  // коэффициент геометрического роста по умолчанию
+
+ private:
+  enum class Kind { ADDITIVE, GEOMETRIC, CUSTOM };
+
+  // поля структуры
+  Kind kind_{Kind::GEOMETRIC};
+  int increment_{0};                       // приращение емкости (аддитивная стратегия)
+  double factor_{kDefaultGrowthFactor};   // коэффициент роста (геометрическая стратегия)
+  Function function_{nullptr};            // функция расширения (пользовательская стратегия)
+
+ public:
+  // конструктор по умолчанию (геометрическая стратегия с коэффициентом kDefaultGrowthFactor)
+  GrowthPolicy() = default;
+
+  /**
+   * Аддитивная стратегия: capacity + increment.
+   *
+   * @param increment - приращение емкости
+   * @throws invalid_argument при неположительном приращении
+   */
+  static GrowthPolicy Additive(int increment);
+
+  /**
+   * Геометрическая стратегия: capacity * factor.
+   *
+   * @param factor - коэффициент роста
+   * @throws invalid_argument при коэффициенте не больше 1
+   */
+  static GrowthPolicy Geometric(double factor = kDefaultGrowthFactor);
+
+  /**
+   * Пользовательская стратегия.
+   *
+   * @param function - функция расширения
+   * @throws invalid_argument при передаче nullptr
+   */
+  static GrowthPolicy Custom(Function function);
+
+  /**
+   * Вычисление новой емкости массива ~ O(1).
+   *
+   * @param capacity - текущая емкость массива
+   * @param min_capacity - минимально необходимая емкость
+   * @return новая емкость, не меньше min_capacity и больше capacity
+   *
+   * @throws length_error если необходимая емкость не представима типом int
+   */
+  int NextCapacity(int capacity, int min_capacity) const;
+
+  bool IsAdditive() const;
+
+  bool IsGeometric() const;
+
+  bool IsCustom() const;
+};
+
+}  // namespace itis
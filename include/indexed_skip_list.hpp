@@ -0,0 +1,211 @@
+#pragma once
+
+#include <cstdint>  // uint64_t
+#include <memory_resource>
+#include <new>  // launder
+#include <ostream>
+#include <vector>
+
+#include "element.hpp"  // Element
+
+namespace itis {
+
+struct SkipNode;
+
+/**
+ * Структура "связь узла списка с пропусками" на одном уровне.
+ * Хранит указатель на следующий узел уровня и ширину связи (кол-во элементов, через которые она "перешагивает").
+ */
+struct SkipLink {
+  SkipNode *next{nullptr};
+  int width{0};  // разность позиций следующего и текущего узлов (для nullptr не используется)
+};
+
+/**
+ * Структура "узел списка с пропусками".
+ * Хранит значение элемента и кол-во уровней, сразу за узлом в памяти располагаются level связей SkipLink.
+ */
+struct SkipNode {
+  Element data{Element::UNINITIALIZED};
+  int level{0};
+
+  SkipNode(Element e, int node_level) : data{e}, level{node_level} {}
+
+  // связи узла: links()[0] - нижний уровень (обычный связный список), links()[level - 1] - верхний уровень
+  SkipLink *links() {
+    return std::launder(reinterpret_cast<SkipLink *>(this + 1));
+  }
+
+  const SkipLink *links() const {
+    return std::launder(reinterpret_cast<const SkipLink *>(this + 1));
+  }
+};
+
+static_assert(sizeof(SkipNode) % alignof(SkipLink) == 0, "SkipLink array must be aligned right after SkipNode");
+
+/**
+ * Структура данных "индексируемый список с пропусками" (indexable skip list).
+ *
+ * Интерфейс совпадает с LinkedList, но помимо обычной цепочки узлов (нижний уровень)
+ * каждый узел с вероятностью 1/2 участвует в следующем, более разреженном уровне.
+ * Каждая связь хранит свою ширину, поэтому по индексу можно спускаться сверху вниз,
+ * "перешагивая" сразу через много элементов: доступ, вставка и удаление по индексу ~ O(log n) в среднем.
+ *
+ * Пример (позиции элементов начинаются с 1, ширина связи в скобках):
+ * уровень 2: head ----------(3)----------> c ---------> nullptr
+ * уровень 1: head --(1)--> a --(2)-------> c --(1)--> d
+ * уровень 0: head --(1)--> a --(1)--> b --(1)--> c --(1)--> d
+ *
+ * Уровни узлов выбираются генератором псевдослучайных чисел:
+ * при одинаковом seed и одинаковой последовательности операций структура списка воспроизводится.
+ */
+struct IndexedSkipList {
+ public:
+  static constexpr int kNotFoundElementIndex = -1;          // индекс ненайденного элемента в списке
+  static constexpr int kMaxLevel = 32;                      // максимальное кол-во уровней
+  static constexpr std::uint64_t kDefaultSeed = 0x5EEDu;   // seed генератора уровней по умолчанию
+
+ private:
+  // поля структуры
+  int size_{0};              // кол-во элементов в списке
+  int level_{1};             // кол-во используемых уровней
+  SkipNode *head_{nullptr};  // узел-заголовок с kMaxLevel связями (создается при первой вставке)
+
+  // состояние генератора уровней (xorshift64*)
+  std::uint64_t random_state_{kDefaultSeed};
+
+  // источник памяти под узлы (по умолчанию: глобальная куча через new/delete)
+  std::pmr::memory_resource *resource_{std::pmr::get_default_resource()};
+
+ public:
+  // конструктор по умолчанию (seed = kDefaultSeed)
+  IndexedSkipList() = default;
+
+  /**
+   * Создание списка с указанным seed генератора уровней и источником памяти.
+   *
+   * @param seed - начальное значение генератора уровней (для воспроизводимых тестов и замеров), 0 заменяется на kDefaultSeed
+   * @param resource - источник памяти
+   * @throws invalid_argument при передаче nullptr
+   */
+  explicit IndexedSkipList(std::uint64_t seed,
+                           std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  // копирование запрещено, используйте Clone()
+  IndexedSkipList(const IndexedSkipList &) = delete;
+  IndexedSkipList &operator=(const IndexedSkipList &) = delete;
+
+  // перемещение ~ O(1), перемещенный список остается пустым
+  IndexedSkipList(IndexedSkipList &&other) noexcept;
+  IndexedSkipList &operator=(IndexedSkipList &&other) noexcept;
+
+  // деструктор
+  virtual ~IndexedSkipList();
+
+  void Swap(IndexedSkipList &other) noexcept;
+
+  // глубокая копия ~ O(n log n), копия продолжает последовательность генератора уровней оригинала
+  IndexedSkipList Clone() const;
+
+  // добавление элемента в конец списка ~ O(log n)
+  void Add(Element e);
+
+  /**
+   * Вставка элемента в список по индексу ~ O(log n).
+   *
+   * Ширина связей, "перешагивающих" позицию вставки, увеличивается на единицу.
+   *
+   * @param index - позиция для вставки элемента
+   * @param e - значение элемента
+   *
+   * @throws out_of_range при передаче индекса за пределами списка
+   */
+  void Insert(int index, Element e);
+
+  /**
+   * Изменение значения элемента списка по индексу ~ O(log n).
+   *
+   * @throws out_of_range при передаче индекса за пределами списка
+   */
+  void Set(int index, Element e);
+
+  /**
+   * Удаление элемента списка по индексу ~ O(log n).
+   *
+   * @param index - индекс удаляемого элемента
+   * @return значение удаленного элемента
+   *
+   * @throws out_of_range при передаче индекса за пределами списка
+   */
+  Element Remove(int index);
+
+  // удаление всех элементов списка ~ O(n)
+  void Clear();
+
+  /**
+   * Получение элемента списка по индексу ~ O(log n).
+   *
+   * @throws out_of_range при передаче индекса за пределами списка
+   */
+  Element Get(int index) const;
+
+  // поиск индекса первого вхождения элемента ~ O(n), -1 при отсутствии элемента в списке
+  int IndexOf(Element e) const;
+
+  bool Contains(Element e) const;
+
+  int Count(Element e) const;
+
+  int GetSize() const;
+
+  bool IsEmpty() const;
+
+  // кол-во используемых уровней
+  int GetLevel() const;
+
+  Element tail() const;
+
+  Element head() const;
+
+  std::pmr::memory_resource *GetMemoryResource() const;
+
+ private:
+
+  // создание узла с указанным кол-вом уровней в памяти источника памяти ~ O(level)
+  SkipNode *create_node(Element e, int level);
+
+  // уничтожение узла, созданного create_node ~ O(1)
+  void destroy_node(SkipNode *node);
+
+  // случайный уровень нового узла: P(level >= k) = 1 / 2^(k - 1)
+  int random_level();
+
+  /**
+   * Поиск узла по индексу ~ O(log n).
+   *
+   * @param index - индекс элемента (0 <= index < size)
+   * @return указатель на узел
+   */
+  SkipNode *find_node(int index) const;
+
+  /**
+   * Поиск предшественников позиции на каждом уровне ~ O(log n).
+   *
+   * @param index - индекс позиции (предшественник - последний узел с позицией <= index, head имеет позицию 0)
+   * @param update - [out] предшественники на уровнях [0, level)
+   * @param rank - [out] позиции предшественников
+   */
+  void find_predecessors(int index, SkipNode **update, int *rank) const;
+
+ public:
+  // необходимо для тестирования
+  explicit IndexedSkipList(const std::vector<Element> &);
+  friend std::ostream &operator<<(std::ostream &, const IndexedSkipList &);
+  friend bool operator==(const IndexedSkipList &, const std::vector<Element> &);
+};
+
+inline void swap(IndexedSkipList &lhs, IndexedSkipList &rhs) noexcept {
+  lhs.Swap(rhs);
+}
+
+}  // namespace itis
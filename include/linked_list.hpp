@@ -1,36 +1,199 @@
 #pragma once
 
+#include <atomic>    // atomic
+#include <cstddef>   // ptrdiff_t
+#include <iterator>  // bidirectional_iterator_tag
+#include <memory_resource>
 #include <ostream>
 #include <vector>
 
-#include "element.hpp"  // Element
+#include "element.hpp"                 // Element
+#include "private/element_counts.hpp"  // ElementCounts
+#include "private/node_pool.hpp"       // NodePool, NodePoolStats
 
 namespace itis {
 
 /**
  * Структура "узел".
- * Хранит в себе данные и указатель на следующий узел.
+ * Хранит в себе данные и указатели на следующий и предыдущий узлы.
  */
 struct Node {
  public:
   // поля структуры
   Element data{Element::UNINITIALIZED};
   Node *next{nullptr};
+  Node *prev{nullptr};
 
   // конструктор
-  Node(Element e, Node *ptr) : data{e}, next{ptr} {}
+  Node(Element e, Node *ptr, Node *prev_ptr = nullptr) : data{e}, next{ptr}, prev{prev_ptr} {}
 };
 
 /**
- * Структура данных "связный список".
+ * Структура данных "двусвязный список".
  *
  * Хранит в себе цепочку узлов со значениями элементов.
  * Характеризуется своим размером (кол-ом элементов).
  * Дополнительно хранит в себе указатели на первый и последний узел.
+ *
+ * Каждый узел связан с соседями в обе стороны:
+ * nullptr <- 1 <-> 2 <-> 3 -> nullptr
+ * поэтому удаление с конца списка ~ O(1), а поиск узла по индексу начинается с ближайшего конца (~ n / 4 шагов в среднем).
+ *
+ * Список запоминает последний найденный по индексу узел ("палец", finger) и начинает с него следующий поиск,
+ * если палец ближе к искомому индексу, чем концы списка.
+ * Поэтому последовательный обход по индексу (for i in [0, n): Get(i)) ~ O(n), а не O(n^2).
+ * Константные методы (Get, IndexOf, ...) можно вызывать из нескольких потоков одновременно:
+ * палец обновляется атомарно целиком (узел и индекс вместе), а при одновременных обновлениях одно из них пропускается.
  */
 struct LinkedList {
  public:
   static constexpr int kNotFoundElementIndex = -1;  // индекс ненайденного элемента в списке
+  static constexpr int kNodesPerSlab = internal::NodePool::kDefaultNodesPerSlab;  // кол-во узлов в слабе пула
+
+  /**
+   * Способ выделения памяти под узлы.
+   *
+   * HEAP - каждый узел выделяется и освобождается через источник памяти по отдельности;
+   * POOL - узлы "нарезаются" из слабов по kNodesPerSlab узлов, освобожденные узлы переиспользуются (free list),
+   *        а слабы возвращаются источнику памяти целиком при очистке и уничтожении списка.
+   */
+  enum class NodeAllocation { HEAP, POOL };
+
+  /**
+   * Двунаправленный итератор по элементам списка (только чтение).
+   *
+   * Используется в range-based for и алгоритмах STL (std::find, std::count_if, ...):
+   * for (Element e : list) { ... }
+   * Остается действительным, пока не удален узел, на который он указывает.
+   */
+  struct Iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Element;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Element *;
+    using reference = const Element &;
+
+   private:
+    const Node *node_{nullptr};         // текущий узел (nullptr для end())
+    const LinkedList *list_{nullptr};  // список (нужен для перехода назад от end())
+
+    Iterator(const Node *node, const LinkedList *list) : node_{node}, list_{list} {}
+
+    friend struct LinkedList;
+
+   public:
+    Iterator() = default;
+
+    reference operator*() const {
+      return node_->data;
+    }
+
+    pointer operator->() const {
+      return &node_->data;
+    }
+
+    Iterator &operator++() {
+      node_ = node_->next;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    Iterator &operator--() {
+      node_ = node_ != nullptr ? node_->prev : list_->tail_;
+      return *this;
+    }
+
+    Iterator operator--(int) {
+      Iterator copy = *this;
+      --*this;
+      return copy;
+    }
+
+    bool operator==(const Iterator &other) const {
+      return node_ == other.node_;
+    }
+
+    bool operator!=(const Iterator &other) const {
+      return node_ != other.node_;
+    }
+  };
+
+  /**
+   * Курсор: позиция в списке, позволяющая изменять список рядом с собой за O(1) без повторного поиска узла.
+   *
+   * Курсор указывает либо на узел списка, либо на позицию "перед началом" (BeforeBegin),
+   * из которой можно вставлять и удалять первый элемент.
+   * Пример (фильтрация за один проход ~ O(n)):
+   * auto cursor = list.BeforeBegin();
+   * while (cursor.HasNext()) {
+   *   if (cursor.GetNext() == Element::SECRET_BOX) cursor.EraseAfter(); else cursor.Next();
+   * }
+   *
+   * Курсор остается действительным, пока не удален узел, на который он указывает.
+   */
+  struct Cursor {
+   private:
+    LinkedList *list_{nullptr};
+    Node *node_{nullptr};  // текущий узел (nullptr - позиция "перед началом")
+
+    Cursor(LinkedList *list, Node *node) : list_{list}, node_{node} {}
+
+    friend struct LinkedList;
+
+   public:
+    // true, если курсор указывает на элемент (а не на позицию "перед началом")
+    bool IsValid() const;
+
+    // true, если за курсором есть элемент
+    bool HasNext() const;
+
+    /**
+     * Переход к следующему элементу ~ O(1).
+     * @throws out_of_range при отсутствии следующего элемента
+     */
+    void Next();
+
+    /**
+     * Значение элемента под курсором ~ O(1).
+     * @throws out_of_range, если курсор не указывает на элемент
+     */
+    Element Get() const;
+
+    /**
+     * Значение элемента, следующего за курсором ~ O(1).
+     * @throws out_of_range при отсутствии следующего элемента
+     */
+    Element GetNext() const;
+
+    /**
+     * Изменение значения элемента под курсором ~ O(1).
+     * @throws out_of_range, если курсор не указывает на элемент
+     */
+    void Set(Element e);
+
+    /**
+     * Вставка элемента сразу за курсором ~ O(1), курсор остается на месте.
+     * 1 -> [2] -> 3 => insert_after(7) => 1 -> [2] -> 7 -> 3
+     *
+     * @param e - значение элемента
+     */
+    void InsertAfter(Element e);
+
+    /**
+     * Удаление элемента, следующего за курсором ~ O(1), курсор остается на месте.
+     * 1 -> [2] -> 3 -> 4 => erase_after() => 1 -> [2] -> 4
+     *
+     * @return значение удаленного элемента
+     * @throws out_of_range при отсутствии следующего элемента
+     */
+    Element EraseAfter();
+  };
 
  private:
   // поля структуры
@@ -38,14 +201,92 @@ struct LinkedList {
   Node *head_{nullptr};  // первый узел
   Node *tail_{nullptr};  // последний узел
 
+  // "палец" (finger): последний найденный по индексу узел и его индекс (nullptr - палец не установлен)
+  struct Finger {
+    Node *node{nullptr};
+    int index{0};
+  };
+
+  // Прим. палец изменяется в константных методах (Get), в том числе из нескольких потоков одновременно:
+  // пара (узел, индекс) защищена счетчиком версий (seqlock, нечетная версия - идет запись), поэтому mutable и atomic
+  mutable std::atomic<Node *> finger_node_{nullptr};
+  mutable std::atomic<int> finger_index_{0};
+  mutable std::atomic<unsigned> finger_version_{0};
+
+  // источник памяти под узлы (по умолчанию: глобальная куча через new/delete)
+  std::pmr::memory_resource *resource_{std::pmr::get_default_resource()};
+
+  // счетчики вхождений элементов (режим статистики, по умолчанию выключен)
+  internal::ElementCounts counts_;
+
+  // пул узлов (используется в режиме NodeAllocation::POOL, иначе выключен)
+  internal::NodePool pool_;
+
  public:
   // конструктор по умолчанию
   // Прим. ключевое слово default говорит компилятору сгенирировать конструктор самостоятельно
   LinkedList() = default;
 
+  /**
+   * Создание списка, выделяющего память под узлы через указанный источник памяти (аллокатор).
+   *
+   * Источник памяти должен "пережить" список.
+   * Для std::pmr::monotonic_buffer_resource очистка списка выполняется за O(1):
+   * память под узлы высвобождается целиком при уничтожении источника памяти.
+   *
+   * @param resource - источник памяти
+   * @throws invalid_argument при передаче nullptr
+   */
+  explicit LinkedList(std::pmr::memory_resource *resource);
+
+  /**
+   * Создание списка с указанным способом выделения памяти под узлы.
+   *
+   * В режиме NodeAllocation::POOL вместо выделения памяти на каждый узел
+   * память запрашивается у источника памяти слабами, что снимает нагрузку с malloc
+   * при частых добавлениях и удалениях (Add/Remove ~ O(1) без обращения к источнику памяти).
+   * Пример: LinkedList list(LinkedList::NodeAllocation::POOL);
+   *
+   * @param allocation - способ выделения памяти под узлы
+   * @param resource - источник памяти (под узлы или слабы)
+   * @throws invalid_argument при передаче nullptr
+   */
+  explicit LinkedList(NodeAllocation allocation,
+                      std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  // копирование запрещено (во избежание двойного освобождения узлов), используйте Clone()
+  LinkedList(const LinkedList &) = delete;
+  LinkedList &operator=(const LinkedList &) = delete;
+
+  /**
+   * Перемещение списка ~ O(1).
+   *
+   * Забирает цепочку узлов у другого списка без копирования.
+   * Перемещенный список остается пустым: {size = 0, head = nullptr, tail = nullptr}.
+   * Источник памяти перемещается вместе с узлами.
+   *
+   * @param other - перемещаемый список
+   */
+  LinkedList(LinkedList &&other) noexcept;
+  LinkedList &operator=(LinkedList &&other) noexcept;
+
   // деструктор
   virtual ~LinkedList();
 
+  /**
+   * Обмен содержимым с другим списком ~ O(1).
+   *
+   * @param other - список для обмена
+   */
+  void Swap(LinkedList &other) noexcept;
+
+  /**
+   * Глубокая копия списка ~ O(n).
+   *
+   * @return копия списка (новая цепочка узлов с теми же значениями и тем же источником памяти)
+   */
+  LinkedList Clone() const;
+
   /**
    * Добавление элемента в конец списка ~ O(1).
    *
@@ -60,7 +301,7 @@ struct LinkedList {
 
   /**
    * Вставка элемента в список по индексу ~ O(n).
-   * Прим. вставка в конец или начало списка ~ O(1).
+   * Прим. вставка в конец или начало списка ~ O(1), в остальных случаях узел ищется с ближайшего конца.
    *
    * Все элементы, находящиеся на позиции вставки и справа от нее, сдвигаются вправо.
    * 1 -> 2 -> 3 -> nullptr => insert(1, 7) => 1 -> 7 -> 2 -> 3 -> nullptr
@@ -73,6 +314,68 @@ struct LinkedList {
    */
   void Insert(int index, Element e);
 
+  /**
+   * Перенос всех элементов другого списка в конец этого списка ~ O(1).
+   *
+   * Узлы other перевязываются без копирования и выделения памяти, если этот список может их освободить:
+   * оба списка выделяют узлы одним способом (NodeAllocation) через равные источники памяти
+   * (в режиме NodeAllocation::POOL слабы и свободные ячейки other переходят к этому списку ~ O(1)).
+   * Иначе элементы копируются ~ O(m), а узлы other освобождаются.
+   * Прим. в режиме статистики, если у other статистика выключена, счетчики пересчитываются ~ O(m).
+   * 1 -> 2 + 3 -> 4 => splice(other) => 1 -> 2 -> 3 -> 4, other: nullptr
+   *
+   * @param other - присоединяемый список (остается пустым)
+   * @throws invalid_argument при попытке присоединить список к самому себе
+   */
+  void Splice(LinkedList &&other);
+
+  /**
+   * Вставка всех элементов другого списка перед позицией index ~ O(n) на поиск позиции.
+   * Прим. вставка в начало или конец списка ~ O(1).
+   *
+   * Узлы other перевязываются без копирования (условия те же, что у Splice).
+   * 1 -> 4 + 2 -> 3 => splice_at(1, other) => 1 -> 2 -> 3 -> 4, other: nullptr
+   *
+   * @param index - позиция вставки первого элемента other
+   * @param other - вставляемый список (остается пустым)
+   *
+   * @throws out_of_range при передаче индекса за пределами списка
+   * @throws invalid_argument при попытке вставить список в самого себя
+   */
+  void SpliceAt(int index, LinkedList &&other);
+
+  /**
+   * Отделение суффикса списка [index, size) в новый список ~ O(n) на поиск позиции.
+   *
+   * Узлы суффикса переходят к новому списку без копирования (новый список использует тот же источник памяти).
+   * Прим. в режиме NodeAllocation::POOL узлы не могут покинуть слабы этого списка: суффикс копируется ~ O(n - index).
+   * Прим. в режиме статистики счетчики обоих списков пересчитываются по меньшей из двух частей.
+   * 1 -> 2 -> 3 -> 4 => split_at(1) => 1, результат: 2 -> 3 -> 4
+   *
+   * @param index - индекс первого элемента суффикса
+   * @return список с элементами [index, size)
+   *
+   * @throws out_of_range при передаче индекса за пределами списка
+   */
+  LinkedList SplitAt(int index);
+
+  /**
+   * Сортировка узлов списка по возрастанию значений Element ~ O(n), без выделения памяти.
+   * Прим. выполняется перевязкой узлов, как StableSort: значения не копируются,
+   * итераторы и курсоры "переезжают" вместе со своими узлами.
+   * 2 -> 0 -> 1 -> 0 => sort => 0 -> 0 -> 1 -> 2
+   */
+  void Sort();
+
+  /**
+   * Устойчивая сортировка узлов списка по возрастанию значений Element ~ O(n), без выделения памяти.
+   *
+   * Узлы перевязываются в kNumElementValues цепочек (по одной на значение) в порядке обхода,
+   * затем цепочки соединяются; значения узлов не копируются.
+   * Узлы с равными значениями сохраняют взаимный порядок, итераторы и курсоры "переезжают" вместе со своими узлами.
+   */
+  void StableSort();
+
   /**
    * Изменение значения элемента списка по индексу ~ O(n).
    *
@@ -85,7 +388,7 @@ struct LinkedList {
 
   /**
    * Удаление элемента списка по индексу ~ O(n).
-   * Прим. при удалении элемента с начала списка ~ O(1).
+   * Прим. при удалении элемента с начала или конца списка ~ O(1).
    *
    * Все элементы, стоящие справа от удаленного элемента сдвигаются влево.
    * 1 -> 2 -> 3 -> nullptr => remove(1) => 1 -> 3 -> nullptr
@@ -102,6 +405,8 @@ struct LinkedList {
    * Удаление всех элементов списка ~ O(n).
    *
    * Происходит высвобождение памяти, выделенной под узлы списка (эквивалетно деструктору).
+   * Прим. для std::pmr::monotonic_buffer_resource узлы не обходятся ~ O(1).
+   * Прим. в режиме NodeAllocation::POOL слабы возвращаются целиком без обхода узлов ~ O(кол-во слабов).
    * 1 -> 2 -> 3 -> nullptr => nullptr
    * {size = 3, head = 1, tail = 3} => {size = 0, head = nullptr, tail = nullptr}
    */
@@ -119,6 +424,7 @@ struct LinkedList {
 
   /**
    * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+   * Прим. в режиме статистики отсутствующий элемент определяется за O(1).
    *
    * @param e - значение элемента
    * @return индекс элемента или -1 при остутствии элемента в списке
@@ -127,6 +433,30 @@ struct LinkedList {
 
   bool Contains(Element e) const;
 
+  /**
+   * Подсчет кол-ва элементов с указанным значением ~ O(n).
+   * Прим. в режиме статистики (и для Contains) ~ O(1).
+   *
+   * @param e - значение элемента
+   * @return кол-во вхождений элемента в список
+   */
+  int Count(Element e) const;
+
+  /**
+   * Обход всех элементов списка ~ O(n): visitor(index, e) вызывается ровно один раз для каждого элемента.
+   *
+   * Порядок вызовов не задан: список обходится одновременно с начала (вперед) и с конца (назад).
+   * Две независимые цепочки указателей позволяют процессору ожидать два промаха кэша одновременно,
+   * поэтому на длинных списках с разбросанными в памяти узлами обход быстрее последовательного.
+   * Для обхода по порядку используйте итераторы (begin, end).
+   * Прим. visitor не должен изменять список.
+   * Пример: list.ForEach([&](int index, Element e) { array[index] = e; });
+   *
+   * @param visitor - функция, принимающая индекс и значение элемента
+   */
+  template<typename Visitor>
+  void ForEach(Visitor &&visitor) const;
+
   int GetSize() const;
 
   bool IsEmpty() const;
@@ -135,15 +465,122 @@ struct LinkedList {
 
   Element head() const;
 
+  // итераторы для range-based for и алгоритмов STL
+  Iterator begin() const;
+
+  Iterator end() const;
+
+  // курсор в позиции "перед началом" (следующий элемент - первый элемент списка)
+  Cursor BeforeBegin();
+
+  /**
+   * Курсор на элементе с указанным индексом ~ O(n).
+   *
+   * @param index - индекс элемента
+   * @throws out_of_range при передаче индекса за пределами списка
+   */
+  Cursor CursorAt(int index);
+
+  std::pmr::memory_resource *GetMemoryResource() const;
+
+  NodeAllocation GetNodeAllocation() const;
+
+  // статистика использования пула узлов (пустая в режиме NodeAllocation::HEAP)
+  NodePoolStats GetNodePoolStats() const;
+
+  /**
+   * Включение режима статистики ~ O(n).
+   *
+   * В режиме статистики список поддерживает кол-во вхождений каждого значения Element
+   * при каждом изменении (Add, Insert, Set, Remove, Clear),
+   * за счет чего Count и Contains выполняются за O(1), а IndexOf сразу завершается для отсутствующих элементов.
+   */
+  void EnableElementCounts();
+
+  // выключение режима статистики ~ O(1)
+  void DisableElementCounts();
+
+  bool HasElementCounts() const;
+
  private:
 
+  /**
+   * Создание узла в памяти источника памяти списка (или пула узлов) ~ O(1).
+   *
+   * @param e - значение элемента
+   * @param next - указатель на следующий узел
+   * @param prev - указатель на предыдущий узел
+   * @return указатель на созданный узел
+   */
+  Node *create_node(Element e, Node *next, Node *prev = nullptr);
+
+  /**
+   * Уничтожение узла, созданного create_node ~ O(1).
+   *
+   * @param node - указатель на узел
+   */
+  void destroy_node(Node *node);
+
   /**
    * Поиск узла по индексу ~ O(n).
+   * Прим. для соседнего с предыдущим поиском индекса ~ O(1).
+   *
+   * Обход начинается с ближайшей к индексу точки: начала, конца списка или пальца (не более n / 2 шагов).
+   * Найденный узел становится новым пальцем: в константных методах - через publish_finger,
+   * в изменяющих список - простой записью (set_finger).
    *
    * @param index - индекс элемента
    * @return указатель на узел
    */
   Node *find_node(int index) const;
+  Node *find_node(int index);
+
+  // обход от ближайшей к индексу точки (начало, конец или палец finger) без обновления пальца
+  Node *walk_to(int index, Finger finger) const;
+
+  // согласованное чтение пальца ~ O(1) (во время чужого обновления - пустой палец)
+  Finger load_finger() const;
+
+  // обновление пальца из константного метода ~ O(1) (пропускается, если палец обновляет другой поток)
+  void publish_finger(Finger finger) const;
+
+  // обновление пальца при изменении списка ~ O(1) (других потоков, работающих со списком, нет)
+  void set_finger(Finger finger);
+
+  /**
+   * Вставка нового узла после указанного узла ~ O(1).
+   *
+   * Индекс пальца сдвигается, если вставка произошла перед ним;
+   * если положение вставки относительно пальца неизвестно, палец сбрасывается.
+   *
+   * @param node - узел, после которого вставляется новый узел (nullptr - вставка в начало списка)
+   * @param e - значение элемента
+   */
+  void insert_after(Node *node, Element e);
+
+  // true, если этот список может освобождать узлы other (узлы можно перевязать без копирования)
+  bool can_adopt_nodes(const LinkedList &other) const;
+
+  /**
+   * Исключение узла из цепочки и его уничтожение ~ O(1).
+   *
+   * Палец на удаляемом узле переносится на соседний узел;
+   * если положение узла относительно пальца неизвестно, палец сбрасывается.
+   *
+   * @param node - удаляемый узел
+   * @return значение элемента узла
+   */
+  Element unlink_node(Node *node);
+
+  /**
+   * Обход узлов с двух концов списка одновременно ~ O(n): visit(index, node) для каждого узла.
+   *
+   * Переход к следующим узлам обеих цепочек читается до вызова visit, поэтому visit может уничтожить узел.
+   *
+   * @param visit - функция, принимающая индекс узла и указатель на узел
+   */
+  template<typename NodeVisitor>
+  void visit_nodes(NodeVisitor &&visit) const;
 
  public:
   // необходимо для тестирования
@@ -152,4 +589,39 @@ struct LinkedList {
   friend bool operator==(const LinkedList &, const std::vector<Element> &);
 };
 
+template<typename NodeVisitor>
+void LinkedList::visit_nodes(NodeVisitor &&visit) const {
+  Node *front_node = head_;
+  Node *back_node = tail_;
+  int front_index = 0;
+  int back_index = size_ - 1;
+
+  // загрузки front_node->next и back_node->prev не зависят друг от друга и выполняются параллельно
+  while (front_index < back_index) {
+    Node *front_next = front_node->next;
+    Node *back_prev = back_node->prev;
+    visit(front_index, front_node);
+    visit(back_index, back_node);
+    front_node = front_next;
+    back_node = back_prev;
+    front_index++;
+    back_index--;
+  }
+
+  // нечетное кол-во узлов: цепочки встретились на среднем узле
+  if (front_index == back_index) {
+    visit(front_index, front_node);
+  }
+}
+
+template<typename Visitor>
+void LinkedList::ForEach(Visitor &&visitor) const {
+  visit_nodes([&visitor](int index, const Node *node) { visitor(index, node->data); });
+}
+
+// обмен содержимым списков (для std::swap и алгоритмов STL)
+inline void swap(LinkedList &lhs, LinkedList &rhs) noexcept {
+  lhs.Swap(rhs);
+}
+
 }  // namespace itis
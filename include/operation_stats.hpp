@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>   // array
+#include <atomic>  // atomic
+
+namespace itis {
+
+// сбор счетчиков включается опцией CMake ADT_ENABLE_STATS (макрос ADT_ENABLE_STATS), по умолчанию выключен
+#ifdef ADT_ENABLE_STATS
+inline constexpr bool kStatsEnabled = true;
+#else
+inline constexpr bool kStatsEnabled = false;
+#endif
+
+/**
+ * Счетчики операций контейнеров (общие для всех экземпляров и потоков).
+ * При выключенном сборе все счетчики равны нулю.
+ */
+struct OperationStats {
+  long long num_resizes{0};              // кол-во расширений ArrayList (вызовов resize)
+  long long resize_bytes_copied{0};      // объем скопированных при расширении ArrayList элементов (в байтах)
+  long long num_nodes_allocated{0};      // кол-во узлов, созданных LinkedList
+  long long num_nodes_freed{0};          // кол-во узлов, освобожденных LinkedList (в том числе целиком при Clear)
+  long long num_nodes_traversed{0};      // кол-во узлов, пройденных LinkedList при поиске по индексу и IndexOf
+  long long num_out_of_range_errors{0};  // кол-во ошибок out_of_range при проверке индексов
+};
+
+// текущие значения счетчиков (читаются без синхронизации с операциями в других потоках)
+OperationStats Stats();
+
+// обнуление счетчиков
+void ResetStats();
+
+namespace internal {
+
+// счетчик операции (индекс в operation_counters)
+enum class Operation {
+  RESIZE,
+  RESIZE_BYTE_COPIED,
+  NODE_ALLOCATED,
+  NODE_FREED,
+  NODE_TRAVERSED,
+  OUT_OF_RANGE_ERROR,
+  NUM_OPERATIONS
+};
+
+#ifdef ADT_ENABLE_STATS
+inline std::array<std::atomic<long long>, static_cast<int>(Operation::NUM_OPERATIONS)> operation_counters{};
+#endif
+
+/**
+ * Учет операций в счетчике ~ O(1).
+ * Счетчики не упорядочивают другие операции с памятью (relaxed), при выключенном сборе вызов пустой.
+ *
+ * @param operation - счетчик операции
+ * @param num - кол-во операций
+ */
+inline void count_operation([[maybe_unused]] Operation operation, [[maybe_unused]] long long num = 1) {
+#ifdef ADT_ENABLE_STATS
+  operation_counters[static_cast<int>(operation)].fetch_add(num, std::memory_order_relaxed);
+#endif
+}
+
+}  // namespace internal
+
+}  // namespace itis
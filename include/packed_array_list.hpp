@@ -0,0 +1,222 @@
+#pragma once
+
+#include <cstdint>  // uint64_t
+#include <memory_resource>
+#include <ostream>
+#include <vector>
+
+#include "element.hpp"        // Element
+#include "growth_policy.hpp"  // GrowthPolicy
+
+namespace itis {
+
+/**
+ * Структура данных "упакованный массив переменной длины".
+ *
+ * Интерфейс совпадает с ArrayList, но каждый элемент хранится в 3 битах (значения Element умещаются в [0, 7]).
+ * В одном 64-битном слове хранится 21 элемент (старший бит слова не используется),
+ * элемент никогда не пересекает границу слова, поэтому адресация элемента ~ O(1):
+ * слово = index / 21, смещение = (index % 21) * 3.
+ *
+ * Пример (слово, младшие биты справа):
+ * [x ... x 2 0 1] => элементы {1, 0, 2}, x = Element::UNINITIALIZED
+ *
+ * По сравнению с ArrayList расход памяти меньше в ~10.7 раза (3 бита против 32 бит на элемент),
+ * а поиск (IndexOf, Contains) обрабатывает сразу 21 элемент за одну операцию над словом.
+ */
+struct PackedArrayList {
+ public:
+  // константы структуры
+  static constexpr int kBitsPerElement = 3;                   // кол-во бит на элемент
+  static constexpr int kElementsPerWord = 21;                 // кол-во элементов в 64-битном слове
+  static constexpr int kInitCapacity = kElementsPerWord;      // изначальная емкость массива
+  static constexpr int kNotFoundElementIndex = -1;            // индекс ненайденного элемента в массиве
+
+ private:
+  // поля структуры
+  int size_{0};                    // размер (кол-во реальных элементов в массиве)
+  int capacity_{0};                // емкость (кол-во ячеек под элементы, кратно kElementsPerWord)
+  std::uint64_t *words_{nullptr};  // указатель на начало непрерывного блока слов с упакованными элементами
+
+  // стратегия расширения емкости
+  GrowthPolicy growth_policy_{GrowthPolicy::Geometric()};
+
+  // источник памяти под слова (по умолчанию: глобальная куча через new/delete)
+  std::pmr::memory_resource *resource_{std::pmr::get_default_resource()};
+
+ public:
+  // конструктор по умолчанию
+  PackedArrayList();
+
+  /**
+   * Создание массива определенной емкости.
+   *
+   * Емкость округляется вверх до кратной kElementsPerWord.
+   * Выделенные ячейки массива инициализируются значением Element::UNINITIALIZED.
+   *
+   * @param capacity - начальная емкость массива
+   * @param growth_policy - стратегия расширения емкости
+   * @param resource - источник памяти
+   * @throws invalid_argument при указании неположительной емкости или передаче nullptr
+   */
+  explicit PackedArrayList(int capacity,
+                           GrowthPolicy growth_policy = GrowthPolicy::Geometric(),
+                           std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  // копирование запрещено, используйте Clone()
+  PackedArrayList(const PackedArrayList &) = delete;
+  PackedArrayList &operator=(const PackedArrayList &) = delete;
+
+  // перемещение ~ O(1), перемещенный массив остается пустым
+  PackedArrayList(PackedArrayList &&other) noexcept;
+  PackedArrayList &operator=(PackedArrayList &&other) noexcept;
+
+  // деструктор
+  virtual ~PackedArrayList();
+
+  void Swap(PackedArrayList &other) noexcept;
+
+  PackedArrayList Clone() const;
+
+  /**
+   * Добавление элемента в конец массива ~ O(1)/O(n).
+   *
+   * @param e - значение элемента
+   */
+  void Add(Element e);
+
+  /**
+   * Добавление последовательности элементов в конец массива ~ O(k)/O(n + k).
+   *
+   * @param elements - указатель на начало последовательности
+   * @param count - кол-во добавляемых элементов
+   *
+   * @throws invalid_argument при отрицательном кол-ве элементов
+   */
+  void AddRange(const Element *elements, int count);
+
+  /**
+   * Вставка элемента в массив по индексу ~ O(n / 21).
+   *
+   * Элементы справа от позиции вставки сдвигаются сразу целыми словами.
+   *
+   * @param index - позиция для вставки элемента
+   * @param e - значение элемента
+   *
+   * @throws out_of_range при передаче индекса за пределами массива
+   */
+  void Insert(int index, Element e);
+
+  /**
+   * Изменение значения элемента массива по индексу ~ O(1).
+   *
+   * @param index - индекс изменяемого элемента массива
+   * @param value - новое значение элемента
+   *
+   * @throws out_of_range при передаче индекса за пределами массива
+   */
+  void Set(int index, Element value);
+
+  /**
+   * Удаление элемента массива по индексу ~ O(n / 21).
+   *
+   * Освободившиаяся ячейка массива инициализируется значением Element::UNINITIALIZED.
+   *
+   * @param index - индекс удаляемого элемента
+   * @return значение удаленного элемента
+   *
+   * @throws out_of_range при передаче индекса за пределами массива
+   */
+  Element Remove(int index);
+
+  /**
+   * Очистка массива ~ O(n / 21).
+   *
+   * Емкость массива остается прежней.
+   * Все освободившиеся ячейки устанавливаются в значение Element::UNINITIALIZED.
+   */
+  void Clear();
+
+  /**
+   * Получение элемента массива по индексу ~ O(1).
+   *
+   * @param index - индекс элемента
+   * @return значение элемента по индексу
+   *
+   * @throws out_of_range при передаче индекса за пределами массива
+   */
+  Element Get(int index) const;
+
+  /**
+   * Распаковка последовательности элементов [from, from + count) в обычный массив ~ O(count).
+   *
+   * @param from - индекс первого распаковываемого элемента
+   * @param count - кол-во распаковываемых элементов
+   * @param out - указатель на массив, вмещающий не менее count элементов
+   *
+   * @throws out_of_range при выходе диапазона за пределы массива
+   */
+  void Unpack(int from, int count, Element *out) const;
+
+  /**
+   * Поиск индекса первого вхождения элемента с указанным значением ~ O(n / 21).
+   *
+   * Сравнение выполняется сразу для 21 элемента слова (SWAR: SIMD within a register).
+   *
+   * @param e - значение элемента
+   * @return индекс элемента или -1 при остутствии элемента в массиве
+   */
+  int IndexOf(Element e) const;
+
+  bool Contains(Element e) const;
+
+  int GetSize() const;
+
+  int GetCapacity() const;
+
+  bool IsEmpty() const;
+
+  // объем памяти (в байтах), занимаемой элементами массива
+  long long GetMemoryUsage() const;
+
+  GrowthPolicy GetGrowthPolicy() const;
+
+  void SetGrowthPolicy(GrowthPolicy growth_policy);
+
+  std::pmr::memory_resource *GetMemoryResource() const;
+
+ private:
+
+  /**
+   * Увеличение емкости массива ~ O(n / 21).
+   *
+   * @param new_capacity - новая емкость массива (округляется вверх до кратной kElementsPerWord)
+   */
+  void resize(int new_capacity);
+
+  // расширение емкости (при необходимости) до вместимости не менее min_capacity
+  void ensure_capacity(int min_capacity);
+
+  // запись значения в ячейку без проверки индекса
+  void put(int index, Element e);
+
+  // чтение значения ячейки без проверки индекса
+  Element take(int index) const;
+
+ public:
+  // необходимо для тестирования
+  friend std::ostream &operator<<(std::ostream &, const PackedArrayList &);
+  friend bool operator==(const PackedArrayList &, const std::vector<Element> &);
+};
+
+inline void swap(PackedArrayList &lhs, PackedArrayList &rhs) noexcept {
+  lhs.Swap(rhs);
+}
+
+// внутренние проверки
+static_assert(static_cast<int>(Element::UNINITIALIZED) < (1 << PackedArrayList::kBitsPerElement),
+              "Element values must fit into PackedArrayList::kBitsPerElement bits");
+static_assert(PackedArrayList::kBitsPerElement * PackedArrayList::kElementsPerWord <= 64,
+              "PackedArrayList word must hold kElementsPerWord elements");
+
+}  // namespace itis
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+
+#include "element.hpp"
+
+namespace itis::internal {
+
+/**
+ * Счетчики кол-ва вхождений каждого значения Element в контейнер.
+ *
+ * Поддерживаются контейнером инкрементально при каждом изменении (если включены),
+ * что позволяет отвечать на вопросы "сколько?" и "есть ли?" за O(1) вместо O(n).
+ * В выключенном состоянии все операции обновления ничего не делают.
+ */
+struct ElementCounts {
+ private:
+  std::array<int, kNumElementValues> counts_{};  // кол-во вхождений каждого значения
+  bool enabled_{false};
+
+ public:
+  bool enabled() const {
+    return enabled_;
+  }
+
+  // включение подсчета: счетчики обнуляются, контейнер должен учесть свои текущие элементы через on_add
+  void enable() {
+    counts_.fill(0);
+    enabled_ = true;
+  }
+
+  void disable() {
+    enabled_ = false;
+  }
+
+  int count(Element e) const {
+    return counts_[static_cast<int>(e)];
+  }
+
+  void on_add(Element e) {
+    if (enabled_) counts_[static_cast<int>(e)] += 1;
+  }
+
+  void on_remove(Element e) {
+    if (enabled_) counts_[static_cast<int>(e)] -= 1;
+  }
+
+  void on_set(Element old_value, Element new_value) {
+    if (enabled_) {
+      counts_[static_cast<int>(old_value)] -= 1;
+      counts_[static_cast<int>(new_value)] += 1;
+    }
+  }
+
+  // num элементов со значением old_value заменены на new_value
+  void on_replace(Element old_value, Element new_value, int num) {
+    if (enabled_) {
+      counts_[static_cast<int>(old_value)] -= num;
+      counts_[static_cast<int>(new_value)] += num;
+    }
+  }
+
+  // добавлены все элементы, учтенные счетчиками other (перенос элементов из другого контейнера)
+  void on_add_all(const ElementCounts &other) {
+    if (enabled_) {
+      for (int value = 0; value < kNumElementValues; value++) counts_[value] += other.counts_[value];
+    }
+  }
+
+  // удалены все элементы, учтенные счетчиками other (перенос элементов в другой контейнер)
+  void on_remove_all(const ElementCounts &other) {
+    if (enabled_) {
+      for (int value = 0; value < kNumElementValues; value++) counts_[value] -= other.counts_[value];
+    }
+  }
+
+  // все элементы удалены
+  void on_clear() {
+    counts_.fill(0);
+  }
+};
+
+}  // namespace itis::internal
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "element.hpp"
+
+namespace itis::internal {
+
+/**
+ * Реализации поиска элементов в непрерывном блоке памяти.
+ *
+ * Векторные реализации (SSE2, AVX2, AVX-512) сравнивают сразу 4, 8 и 16 элементов за инструкцию.
+ * Реализация выбирается один раз во время выполнения по возможностям процессора (CPUID),
+ * скалярная реализация доступна всегда и служит эталоном для тестов.
+ */
+enum class SearchKernel {
+  SCALAR,
+  SSE2,
+  AVX2,
+  AVX512
+};
+
+/**
+ * Проверка поддержки реализации текущим процессором и компилятором.
+ *
+ * @param kernel - реализация поиска
+ * @return true, если реализацию можно вызывать
+ */
+bool is_supported(SearchKernel kernel);
+
+/**
+ * Лучшая из поддерживаемых реализаций (определяется один раз при первом вызове).
+ *
+ * @return реализация, используемая функциями поиска по умолчанию
+ */
+SearchKernel best_search_kernel();
+
+/**
+ * Поиск индекса первого вхождения элемента ~ O(n).
+ *
+ * @param data - указатель на начало блока элементов
+ * @param size - кол-во элементов
+ * @param e - значение элемента
+ * @return индекс элемента или -1 при отсутствии элемента
+ */
+int index_of(const Element *data, int size, Element e);
+
+/**
+ * Поиск индекса последнего вхождения элемента ~ O(n).
+ *
+ * @return индекс элемента или -1 при отсутствии элемента
+ */
+int last_index_of(const Element *data, int size, Element e);
+
+/**
+ * Подсчет кол-ва вхождений элемента ~ O(n).
+ *
+ * @return кол-во элементов, равных e
+ */
+int count(const Element *data, int size, Element e);
+
+// то же самое с явным выбором реализации (реализация должна поддерживаться, см. is_supported)
+int index_of(const Element *data, int size, Element e, SearchKernel kernel);
+
+int last_index_of(const Element *data, int size, Element e, SearchKernel kernel);
+
+int count(const Element *data, int size, Element e, SearchKernel kernel);
+
+}  // namespace itis::internal
@@ -8,11 +8,13 @@
 // ВОЗРАДУЙТЕСЬ, ИБО БЕЗГРАНИЧНАЯ СИЛА ПОЗНАНИЯ НАПОЛНЯЕТ НАШИ ПЫЛАЮЩИЕ СЕРДЦА...
 // P.S. Я писал это в 2:36 МСК, простите меня
 
+#include <memory_resource>
 #include <sstream>
 #include <stdexcept>
 #include <string_view>
 
 #include "element.hpp"
+#include "operation_stats.hpp"
 
 namespace itis::internal {
 
@@ -28,6 +30,7 @@ namespace itis::internal {
 inline void check_out_of_range(int index, int min, int max) {
   if (index >= min && index < max) return;
 
+  count_operation(Operation::OUT_OF_RANGE_ERROR);
   std::stringstream ss("index is out of range: ");
   ss << '[' << min << ',' << max << ']';
   throw std::out_of_range(ss.str());
@@ -51,4 +54,15 @@ inline constexpr std::string_view elem_to_str(Element e) {
   }
 }
 
+/**
+ * Проверка, освобождает ли источник памяти выделенные блоки только целиком (при своем уничтожении).
+ * Для таких источников поэлементное освобождение памяти не имеет смысла и может быть пропущено.
+ *
+ * @param resource - источник памяти
+ * @return true для std::pmr::monotonic_buffer_resource
+ */
+inline bool releases_memory_in_bulk(const std::pmr::memory_resource *resource) {
+  return dynamic_cast<const std::pmr::monotonic_buffer_resource *>(resource) != nullptr;
+}
+
 }  // namespace itis::internal
\ No newline at end of file
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <memory_resource>
+
+namespace itis {
+
+/**
+ * Статистика использования пула узлов.
+ */
+struct NodePoolStats {
+  int num_slabs{0};             // кол-во выделенных слабов (крупных блоков памяти под узлы)
+  int num_nodes_in_use{0};      // кол-во узлов, занятых элементами
+  int num_free_nodes{0};        // кол-во свободных ячеек под узлы (в списке свободных и еще не использованных)
+  long long bytes_reserved{0};  // объем памяти, занятой слабами (в байтах)
+};
+
+namespace internal {
+
+/**
+ * Пул узлов фиксированного размера.
+ *
+ * Память запрашивается у источника памяти крупными блоками (слабами) по nodes_per_slab узлов,
+ * узлы "нарезаются" из текущего слаба по мере необходимости.
+ * Освобожденные узлы попадают в список свободных узлов (free list) и выдаются повторно в первую очередь.
+ * Невыданные ячейки слабов, полученных слиянием (merge), хранятся списком диапазонов и нарезаются, как текущий слаб.
+ * Слабы возвращаются источнику памяти только целиком: при release() (очистка или уничтожение контейнера).
+ *
+ * Пул не хранит источник памяти: его передает контейнер-владелец (один и тот же при каждом вызове).
+ * Пул, созданный конструктором по умолчанию, выключен и не должен использоваться для выделения узлов.
+ */
+struct NodePool {
+ public:
+  static constexpr int kDefaultNodesPerSlab = 256;  // кол-во узлов в слабе по умолчанию
+
+ private:
+  // заголовок слаба (в начале каждого слаба)
+  struct Slab {
+    Slab *next;
+  };
+
+  // свободный узел: память узла хранит указатель на следующий свободный узел
+  struct FreeNode {
+    FreeNode *next;
+  };
+
+  // диапазон невыданных ячеек [this, end): заголовок лежит в первой ячейке диапазона
+  struct FreeRange {
+    FreeRange *next;
+    char *end;
+  };
+
+  // параметры пула
+  std::size_t node_size_{0};       // размер ячейки под узел (не меньше sizeof(FreeRange))
+  std::size_t node_alignment_{0};  // выравнивание узла
+  std::size_t nodes_offset_{0};    // смещение первого узла от начала слаба (после заголовка)
+  int nodes_per_slab_{0};          // кол-во узлов в слабе
+
+  // состояние пула
+  Slab *slabs_{nullptr};                  // список выделенных слабов
+  Slab *last_slab_{nullptr};              // последний слаб списка (для слияния ~ O(1))
+  FreeNode *free_list_{nullptr};          // список освобожденных узлов
+  FreeNode *free_list_tail_{nullptr};     // последний освобожденный узел списка (при непустом списке)
+  FreeRange *free_ranges_{nullptr};       // диапазоны невыданных ячеек слабов, полученных слиянием
+  FreeRange *free_ranges_tail_{nullptr};  // последний диапазон списка (при непустом списке)
+  char *next_unused_{nullptr};            // следующая еще не выданная ячейка текущего диапазона (слаба)
+  char *current_slab_end_{nullptr};       // конец текущего диапазона (слаба)
+  int num_slabs_{0};
+  int num_nodes_in_use_{0};
+
+ public:
+  // выключенный пул
+  NodePool() = default;
+
+  /**
+   * Создание пула (слабы не выделяются до первого запроса узла).
+   *
+   * @param node_size - размер узла
+   * @param node_alignment - выравнивание узла
+   * @param nodes_per_slab - кол-во узлов в слабе
+   * @throws invalid_argument при неположительном кол-ве узлов в слабе
+   */
+  NodePool(std::size_t node_size, std::size_t node_alignment, int nodes_per_slab = kDefaultNodesPerSlab);
+
+  bool enabled() const {
+    return nodes_per_slab_ > 0;
+  }
+
+  int nodes_per_slab() const {
+    return nodes_per_slab_;
+  }
+
+  // пустой пул с теми же параметрами
+  NodePool empty_copy() const {
+    return enabled() ? NodePool(node_size_, node_alignment_, nodes_per_slab_) : NodePool();
+  }
+
+  /**
+   * Выделение памяти под узел ~ O(1).
+   * Прим. при исчерпании текущего слаба выделяется новый слаб.
+   *
+   * @param resource - источник памяти под слабы
+   * @return указатель на неинициализированную память под узел
+   */
+  void *allocate(std::pmr::memory_resource *resource);
+
+  // возврат узла в список свободных узлов ~ O(1)
+  void deallocate(void *node);
+
+  /**
+   * Возврат всех слабов источнику памяти ~ O(кол-во слабов).
+   * Все выданные узлы становятся недействительными (деструкторы узлов не вызываются).
+   *
+   * @param resource - источник памяти, из которого выделялись слабы
+   */
+  void release(std::pmr::memory_resource *resource);
+
+  // отказ от слабов без их освобождения (слабы перешли к другому владельцу), параметры пула сохраняются
+  void reset();
+
+  /**
+   * Перенос слабов другого пула с теми же параметрами в этот пул ~ O(1).
+   *
+   * Выданные пулом other узлы становятся узлами этого пула (их можно освобождать через deallocate),
+   * списки слабов, свободных узлов и диапазонов other присоединяются через указатели на их концы,
+   * еще не выданные ячейки текущего слаба other становятся диапазоном и нарезаются без обхода.
+   * Пул other остается пустым.
+   *
+   * @param other - пул, выделивший слабы через тот же источник памяти
+   */
+  void merge(NodePool &other);
+
+  NodePoolStats stats() const;
+
+ private:
+  std::size_t slab_size() const;
+
+  // выделение нового слаба и переход к нему
+  void add_slab(std::pmr::memory_resource *resource);
+};
+
+}  // namespace internal
+
+}  // namespace itis
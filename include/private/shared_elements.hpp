@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>  // atomic
+#include <memory_resource>
+#include <new>     // placement new
+
+#include "element.hpp"
+
+namespace itis::internal {
+
+/**
+ * Блок управления разделяемым буфером элементов (копирование при записи).
+ *
+ * Хранит счетчик владельцев буфера и все, что нужно для его освобождения.
+ * Создается лениво: пока снимков массива нет, массив владеет буфером единолично и блок не нужен.
+ * Счетчик атомарный: снимки могут копироваться и уничтожаться в разных потоках.
+ */
+struct SharedElements {
+ private:
+  std::atomic<int> num_owners_{1};
+  Element *data_;
+  int capacity_;
+  std::pmr::memory_resource *resource_;
+
+  SharedElements(Element *data, int capacity, std::pmr::memory_resource *resource)
+      : data_{data}, capacity_{capacity}, resource_{resource} {}
+
+ public:
+  // создание блока для буфера data с единственным владельцем (блок выделяется через тот же источник памяти)
+  static SharedElements *create(Element *data, int capacity, std::pmr::memory_resource *resource) {
+    void *memory = resource->allocate(sizeof(SharedElements), alignof(SharedElements));
+    return new (memory) SharedElements(data, capacity, resource);
+  }
+
+  // уничтожение блока без освобождения буфера (единственный владелец забирает буфер себе)
+  static void destroy(SharedElements *shared) {
+    std::pmr::memory_resource *resource = shared->resource_;
+    shared->~SharedElements();
+    resource->deallocate(shared, sizeof(SharedElements), alignof(SharedElements));
+  }
+
+  // отказ от владения: последний владелец освобождает буфер и блок
+  static void release(SharedElements *shared) {
+    if (shared->num_owners_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      shared->resource_->deallocate(shared->data_, sizeof(Element) * shared->capacity_, alignof(Element));
+      destroy(shared);
+    }
+  }
+
+  void acquire() {
+    num_owners_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // true, если других владельцев нет (все снимки уничтожены), acquire: их чтения буфера завершены
+  bool unique() const {
+    return num_owners_.load(std::memory_order_acquire) == 1;
+  }
+};
+
+}  // namespace itis::internal
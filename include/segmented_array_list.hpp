@@ -0,0 +1,229 @@
+#pragma once
+
+#include <memory_resource>
+#include <ostream>
+#include <vector>
+
+#include "element.hpp"  // Element
+
+namespace itis {
+
+/**
+ * Структура данных "сегментированный массив" (массив из блоков фиксированного размера).
+ *
+ * Элементы хранятся в блоках (chunks) по kChunkSize элементов, указатели на блоки - в каталоге (directory).
+ * Индекс элемента переводится в номер блока и смещение в нем сдвигом и маской: Get ~ O(1).
+ *
+ * Пример (kChunkSize = 4):
+ * каталог: [*] [*] [*]
+ *           |   |   '-> [8 9 x x]
+ *           |   '-----> [4 5 6 7]
+ *           '---------> [0 1 2 3]
+ *
+ * Расширение добавляет новый блок и никогда не перемещает уже добавленные элементы:
+ * копируется только каталог (указатели, kChunkSize элементов на указатель),
+ * поэтому пиковое потребление памяти при росте близко к живому размеру массива,
+ * а указатели на ячейки (ElementPointer) остаются действительными при добавлении элементов.
+ */
+struct SegmentedArrayList {
+ public:
+  // константы структуры
+  static constexpr int kChunkShift = 12;                // log2 размера блока [МОЖНО ИЗМЕНЯТЬ]
+  static constexpr int kChunkSize = 1 << kChunkShift;   // кол-во элементов в блоке
+  static constexpr int kChunkMask = kChunkSize - 1;     // маска смещения в блоке
+  static constexpr int kInitDirectoryCapacity = 4;      // изначальная емкость каталога (блоков)
+  static constexpr int kNotFoundElementIndex = -1;      // индекс ненайденного элемента в массиве
+
+ private:
+  // поля структуры
+  int size_{0};                      // кол-во элементов
+  int num_chunks_{0};                // кол-во выделенных блоков (емкость = num_chunks * kChunkSize)
+  int directory_capacity_{0};        // емкость каталога (блоков)
+  Element **directory_{nullptr};     // каталог: указатели на блоки
+
+  // источник памяти под блоки и каталог (по умолчанию: глобальная куча через new/delete)
+  std::pmr::memory_resource *resource_{std::pmr::get_default_resource()};
+
+ public:
+  // конструктор по умолчанию (блоки выделяются при добавлении элементов)
+  SegmentedArrayList() = default;
+
+  /**
+   * Создание массива, выделяющего память под блоки через указанный источник памяти.
+   *
+   * @param resource - источник памяти
+   * @throws invalid_argument при передаче nullptr
+   */
+  explicit SegmentedArrayList(std::pmr::memory_resource *resource);
+
+  // копирование запрещено (во избежание двойного освобождения памяти), используйте Clone()
+  SegmentedArrayList(const SegmentedArrayList &) = delete;
+  SegmentedArrayList &operator=(const SegmentedArrayList &) = delete;
+
+  /**
+   * Перемещение массива ~ O(1).
+   * Перемещенный массив остается пустым и без блоков.
+   *
+   * @param other - перемещаемый массив
+   */
+  SegmentedArrayList(SegmentedArrayList &&other) noexcept;
+  SegmentedArrayList &operator=(SegmentedArrayList &&other) noexcept;
+
+  // деструктор
+  ~SegmentedArrayList();
+
+  /**
+   * Обмен содержимым с другим массивом ~ O(1).
+   *
+   * @param other - массив для обмена
+   */
+  void Swap(SegmentedArrayList &other) noexcept;
+
+  // глубокая копия массива ~ O(n) (с тем же источником памяти)
+  SegmentedArrayList Clone() const;
+
+  /**
+   * Добавление элемента в конец массива ~ O(1).
+   * Прим. при заполнении последнего блока выделяется новый блок, элементы не перемещаются.
+   *
+   * @param e - значение элемента
+   */
+  void Add(Element e);
+
+  /**
+   * Добавление элементов в конец массива ~ O(count) (копирование по блокам).
+   *
+   * @param elements - указатель на первый элемент диапазона
+   * @param count - кол-во элементов
+   * @throws invalid_argument при отрицательном кол-ве элементов
+   */
+  void AddRange(const Element *elements, int count);
+
+  /**
+   * Вставка элемента по индексу ~ O(n - index).
+   *
+   * Элементы справа от позиции вставки сдвигаются внутри своих блоков,
+   * последний элемент каждого блока переносится в начало следующего.
+   *
+   * @param index - позиция для вставки элемента
+   * @param e - значение элемента
+   * @throws out_of_range при передаче индекса за пределами массива
+   */
+  void Insert(int index, Element e);
+
+  /**
+   * Изменение значения элемента по индексу ~ O(1).
+   *
+   * @param index - индекс элемента
+   * @param e - новое значение элемента
+   * @throws out_of_range при передаче индекса за пределами массива
+   */
+  void Set(int index, Element e);
+
+  /**
+   * Удаление элемента по индексу ~ O(n - index).
+   * Освободившаяся ячейка получает значение Element::UNINITIALIZED, блоки не освобождаются.
+   *
+   * @param index - индекс удаляемого элемента
+   * @return значение удаленного элемента
+   * @throws out_of_range при передаче индекса за пределами массива
+   */
+  Element Remove(int index);
+
+  /**
+   * Удаление всех элементов ~ O(n), блоки сохраняются (емкость не меняется).
+   */
+  void Clear();
+
+  /**
+   * Резервирование емкости ~ O(capacity - текущая емкость), элементы не перемещаются.
+   *
+   * @param capacity - минимальная емкость массива
+   */
+  void Reserve(int capacity);
+
+  /**
+   * Освобождение блоков, не содержащих элементов ~ O(кол-во освобождаемых блоков).
+   * Элементы не перемещаются.
+   */
+  void ShrinkToFit();
+
+  /**
+   * Получение элемента по индексу ~ O(1).
+   *
+   * @param index - индекс элемента
+   * @return значение элемента по индексу
+   * @throws out_of_range при передаче индекса за пределами массива
+   */
+  Element Get(int index) const;
+
+  /**
+   * Указатель на ячейку элемента ~ O(1).
+   *
+   * Ячейка не перемещается при добавлении элементов и росте емкости (Add, AddRange, Reserve);
+   * Insert и Remove сдвигают значения между ячейками, Clear/ShrinkToFit/уничтожение массива освобождают блоки.
+   *
+   * @param index - индекс элемента
+   * @return указатель на ячейку элемента
+   * @throws out_of_range при передаче индекса за пределами массива
+   */
+  const Element *ElementPointer(int index) const;
+
+  /**
+   * Поиск индекса первого вхождения элемента ~ O(n) (векторный поиск по блокам).
+   *
+   * @param e - значение элемента
+   * @return индекс элемента или -1 при остутствии элемента в массиве
+   */
+  int IndexOf(Element e) const;
+
+  bool Contains(Element e) const;
+
+  // подсчет кол-ва элементов с указанным значением ~ O(n) (векторный подсчет по блокам)
+  int Count(Element e) const;
+
+  int GetSize() const;
+
+  // емкость: кол-во ячеек в выделенных блоках
+  int GetCapacity() const;
+
+  bool IsEmpty() const;
+
+  std::pmr::memory_resource *GetMemoryResource() const;
+
+ private:
+
+  // кол-во блоков, содержащих элементы
+  int num_used_chunks() const;
+
+  // кол-во элементов в блоке chunk (полный блок или последний частично заполненный)
+  int chunk_size(int chunk) const;
+
+  /**
+   * Добавление блоков до емкости не менее min_capacity ~ O(кол-во новых блоков).
+   * Каталог расширяется вдвое при нехватке места (копируются только указатели).
+   *
+   * @param min_capacity - минимально необходимая емкость
+   */
+  void ensure_capacity(int min_capacity);
+
+  // освобождение блоков начиная с first_chunk и (при first_chunk = 0) каталога
+  void release_chunks(int first_chunk);
+
+ public:
+  // необходимо для тестирования
+  explicit SegmentedArrayList(const std::vector<Element> &);
+  friend std::ostream &operator<<(std::ostream &, const SegmentedArrayList &);
+  friend bool operator==(const SegmentedArrayList &, const std::vector<Element> &);
+};
+
+// обмен содержимым массивов (для std::swap и алгоритмов STL)
+inline void swap(SegmentedArrayList &lhs, SegmentedArrayList &rhs) noexcept {
+  lhs.Swap(rhs);
+}
+
+// внутренние проверки
+static_assert(SegmentedArrayList::kChunkShift > 0 && SegmentedArrayList::kChunkShift < 31,
+              "SegmentedArrayList chunk size must fit into int");
+
+}  // namespace itis
@@ -0,0 +1,337 @@
+#pragma once
+
+#include <algorithm>   // copy, fill, max
+#include <cassert>     // assert
+#include <cstring>     // memmove, memcpy
+#include <functional>  // less
+#include <memory_resource>
+#include <ostream>
+#include <stdexcept>   // invalid_argument
+#include <utility>     // move
+#include <vector>
+
+#include "array_list.hpp"              // ArrayList
+#include "element.hpp"                 // Element
+#include "growth_policy.hpp"           // GrowthPolicy
+#include "private/element_search.hpp"  // векторный поиск элементов
+#include "private/internal.hpp"        // вспомогательные функции
+
+namespace itis {
+
+/**
+ * Структура данных "массив переменной длины с встроенным буфером" (small buffer optimization).
+ *
+ * Интерфейс совпадает с ArrayList, но первые N элементов хранятся внутри самого объекта,
+ * поэтому создание и уничтожение небольшого массива не обращается к куче.
+ * При превышении N элементы переносятся в блок памяти, выделенный через источник памяти,
+ * и дальше массив ведет себя как обычный ArrayList (обратно во встроенный буфер не возвращается).
+ *
+ * Пример (N = 4):
+ * [1 2 3 x] (встроенный буфер) => add(4), add(5) => [1 2 3 4 5 x x x] (куча)
+ *
+ * @tparam N - кол-во элементов во встроенном буфере
+ */
+template<int N = 16>
+struct SmallArrayList {
+  static_assert(N > 0, "SmallArrayList inline capacity must be positive");
+
+ public:
+  // константы структуры
+  static constexpr int kInlineCapacity = N;         // емкость встроенного буфера
+  static constexpr int kNotFoundElementIndex = -1;  // индекс ненайденного элемента в массиве
+
+ private:
+  // поля структуры
+  int size_{0};                  // размер (кол-во реальных элементов в массиве)
+  int capacity_{N};              // емкость (N для встроенного буфера)
+  Element inline_[N];            // встроенный буфер
+  Element *data_{inline_};       // указатель на встроенный буфер или на блок памяти в куче
+
+  // стратегия расширения емкости (после выхода за пределы встроенного буфера)
+  GrowthPolicy growth_policy_{GrowthPolicy::Geometric()};
+
+  // источник памяти под элементы, не поместившиеся во встроенный буфер
+  std::pmr::memory_resource *resource_{std::pmr::get_default_resource()};
+
+ public:
+  /**
+   * Создание пустого массива ~ O(N), память не выделяется.
+   *
+   * @param growth_policy - стратегия расширения емкости
+   * @param resource - источник памяти
+   * @throws invalid_argument при передаче nullptr
+   */
+  explicit SmallArrayList(GrowthPolicy growth_policy = GrowthPolicy::Geometric(),
+                          std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : growth_policy_{growth_policy}, resource_{resource} {
+    if (resource == nullptr) {
+      throw std::invalid_argument("SmallArrayList::resource must not be null");
+    }
+    std::fill(inline_, inline_ + N, Element::UNINITIALIZED);
+  }
+
+  /**
+   * Создание массива с элементами ArrayList ~ O(n).
+   * Стратегия расширения и источник памяти берутся у исходного массива.
+   *
+   * @param list - исходный массив
+   */
+  explicit SmallArrayList(const ArrayList &list)
+      : SmallArrayList(list.GetGrowthPolicy(), list.GetMemoryResource()) {
+    ensure_capacity(list.GetSize());
+    for (int index = 0; index < list.GetSize(); index++) {
+      data_[index] = list.Get(index);
+    }
+    size_ = list.GetSize();
+  }
+
+  // копирование запрещено, используйте Clone()
+  SmallArrayList(const SmallArrayList &) = delete;
+  SmallArrayList &operator=(const SmallArrayList &) = delete;
+
+  /**
+   * Перемещение массива ~ O(1) для элементов в куче, ~ O(N) для встроенного буфера.
+   * Перемещенный массив остается пустым и снова использует встроенный буфер.
+   */
+  SmallArrayList(SmallArrayList &&other) noexcept {
+    steal(other);
+  }
+
+  SmallArrayList &operator=(SmallArrayList &&other) noexcept {
+    if (this != &other) {
+      release();
+      steal(other);
+    }
+    return *this;
+  }
+
+  // деструктор
+  virtual ~SmallArrayList() {
+    release();
+  }
+
+  void Swap(SmallArrayList &other) noexcept {
+    if (this == &other) return;
+
+    SmallArrayList moved{std::move(other)};
+    other.steal(*this);
+    steal(moved);
+  }
+
+  SmallArrayList Clone() const {
+    SmallArrayList clone(growth_policy_, resource_);
+    if (capacity_ > N) clone.resize(capacity_);
+    std::copy(data_, data_ + size_, clone.data_);
+    clone.size_ = size_;
+    return clone;
+  }
+
+  /**
+   * Преобразование в ArrayList ~ O(n).
+   * Емкость, стратегия расширения и источник памяти сохраняются.
+   *
+   * @return массив с теми же элементами
+   */
+  ArrayList ToArrayList() const {
+    ArrayList list(capacity_, growth_policy_, resource_);
+    list.AddRange(data_, size_);
+    return list;
+  }
+
+  // добавление элемента в конец массива ~ O(1)/O(n)
+  void Add(Element e) {
+    ensure_capacity(size_ + 1);
+    data_[size_] = e;
+    size_ += 1;
+  }
+
+  // вставка элемента по индексу ~ O(n), out_of_range при передаче индекса за пределами массива
+  void Insert(int index, Element e) {
+    internal::check_out_of_range(index, 0, size_ + 1);
+    ensure_capacity(size_ + 1);
+
+    std::memmove(data_ + index + 1, data_ + index, sizeof(Element) * (size_ - index));
+    data_[index] = e;
+    size_ += 1;
+  }
+
+  // добавление последовательности элементов в конец массива ~ O(k)/O(n + k)
+  void AddRange(const Element *elements, int count) {
+    if (count < 0) {
+      throw std::invalid_argument("SmallArrayList::count must not be negative");
+    }
+    if (count == 0) return;
+    // std::less задает полный порядок и для указателей в разные массивы (встроенные < и >= - нет)
+    if (!std::less<const Element *>{}(elements, data_) && std::less<const Element *>{}(elements, data_ + capacity_)) {
+      // добавляем часть самого себя: буфер может переехать
+      const std::vector<Element> copy(elements, elements + count);
+      AddRange(copy.data(), count);
+      return;
+    }
+    ensure_capacity(size_ + count);
+    std::memcpy(data_ + size_, elements, sizeof(Element) * count);
+    size_ += count;
+  }
+
+  void Set(int index, Element value) {
+    internal::check_out_of_range(index, 0, size_);
+    data_[index] = value;
+  }
+
+  // удаление элемента по индексу ~ O(n), освободившаяся ячейка получает значение Element::UNINITIALIZED
+  Element Remove(int index) {
+    internal::check_out_of_range(index, 0, size_);
+
+    const Element result = data_[index];
+    std::memmove(data_ + index, data_ + index + 1, sizeof(Element) * (size_ - index - 1));
+    size_ -= 1;
+    data_[size_] = Element::UNINITIALIZED;
+    return result;
+  }
+
+  // очистка массива ~ O(n), емкость (и выделенный блок памяти) сохраняется
+  void Clear() {
+    std::fill(data_, data_ + size_, Element::UNINITIALIZED);
+    size_ = 0;
+  }
+
+  Element Get(int index) const {
+    internal::check_out_of_range(index, 0, size_);
+    return data_[index];
+  }
+
+  int IndexOf(Element e) const {
+    return internal::index_of(data_, size_, e);
+  }
+
+  int LastIndexOf(Element e) const {
+    return internal::last_index_of(data_, size_, e);
+  }
+
+  bool Contains(Element e) const {
+    return IndexOf(e) != kNotFoundElementIndex;
+  }
+
+  int Count(Element e) const {
+    return internal::count(data_, size_, e);
+  }
+
+  int GetSize() const {
+    return size_;
+  }
+
+  int GetCapacity() const {
+    return capacity_;
+  }
+
+  bool IsEmpty() const {
+    return size_ == 0;
+  }
+
+  // true, пока элементы хранятся во встроенном буфере
+  bool IsInline() const {
+    return data_ == inline_;
+  }
+
+  GrowthPolicy GetGrowthPolicy() const {
+    return growth_policy_;
+  }
+
+  void SetGrowthPolicy(GrowthPolicy growth_policy) {
+    growth_policy_ = growth_policy;
+  }
+
+  std::pmr::memory_resource *GetMemoryResource() const {
+    return resource_;
+  }
+
+ private:
+
+  // расширение емкости (при необходимости) до вместимости не менее min_capacity
+  void ensure_capacity(int min_capacity) {
+    if (min_capacity > capacity_) {
+      resize(growth_policy_.NextCapacity(capacity_, min_capacity));
+    }
+  }
+
+  /**
+   * Перенос элементов в новый блок памяти в куче ~ O(n).
+   *
+   * @param new_capacity - новая емкость массива (должна быть больше предыдущей)
+   */
+  void resize(int new_capacity) {
+    assert(new_capacity > capacity_);
+
+    auto *new_data = static_cast<Element *>(resource_->allocate(sizeof(Element) * new_capacity, alignof(Element)));
+    std::copy(data_, data_ + size_, new_data);
+    std::fill(new_data + size_, new_data + new_capacity, Element::UNINITIALIZED);
+
+    release_heap();
+
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  // освобождение блока памяти в куче (если он есть), указатель на данные не изменяется
+  void release_heap() {
+    if (!IsInline()) {
+      resource_->deallocate(data_, sizeof(Element) * capacity_, alignof(Element));
+    }
+  }
+
+  // освобождение памяти и возврат к пустому встроенному буферу
+  void release() noexcept {
+    release_heap();
+    std::fill(inline_, inline_ + N, Element::UNINITIALIZED);
+    data_ = inline_;
+    capacity_ = N;
+    size_ = 0;
+  }
+
+  /**
+   * Перенос содержимого другого массива в этот массив (этот массив не должен владеть блоком памяти в куче).
+   * Другой массив остается пустым и использует встроенный буфер.
+   * Прим. если элементы находятся в куче, встроенный буфер не используется и заполняется только при release().
+   */
+  void steal(SmallArrayList &other) noexcept {
+    assert(IsInline());
+
+    growth_policy_ = other.growth_policy_;
+    resource_ = other.resource_;
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+
+    if (other.IsInline()) {
+      std::copy(other.inline_, other.inline_ + N, inline_);
+      data_ = inline_;
+    } else {
+      data_ = other.data_;
+    }
+
+    other.data_ = other.inline_;  // блок памяти в куче теперь принадлежит этому массиву
+    other.release();
+  }
+
+ public:
+  // необходимо для тестирования
+  friend std::ostream &operator<<(std::ostream &os, const SmallArrayList &list) {
+    os << "{ ";
+    for (int index = 0; index < list.capacity_ - 1; index++) {
+      os << internal::elem_to_str(list.data_[index]) << ", ";
+    }
+    os << internal::elem_to_str(list.data_[list.capacity_ - 1]) << " }";
+    return os;
+  }
+
+  friend bool operator==(const SmallArrayList &list, const std::vector<Element> &elements) {
+    if (list.capacity_ != static_cast<int>(elements.size())) return false;
+    return std::equal(list.data_, list.data_ + list.capacity_, elements.begin());
+  }
+};
+
+template<int N>
+inline void swap(SmallArrayList<N> &lhs, SmallArrayList<N> &rhs) noexcept {
+  lhs.Swap(rhs);
+}
+
+}  // namespace itis
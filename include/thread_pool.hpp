@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>              // atomic
+#include <condition_variable>  // condition_variable
+#include <deque>               // deque
+#include <functional>          // function
+#include <memory>              // unique_ptr
+#include <mutex>               // mutex
+#include <thread>              // thread
+#include <vector>              // vector
+
+namespace itis {
+
+/**
+ * Пул потоков с перехватом работы (work stealing) для параллельных проходов по контейнерам.
+ *
+ * У каждого рабочего потока своя очередь задач: поток берет задачи с конца своей очереди,
+ * а оставшись без работы, "крадет" задачи с начала чужих очередей.
+ * Вызывающий ParallelFor поток не простаивает: пока его задачи не завершены, он выполняет задачи из очередей сам,
+ * поэтому ParallelFor можно вызывать и изнутри задач (вложенный параллелизм без взаимоблокировок).
+ * Когда очереди пусты, а взятые другими потоками части еще выполняются, вызывающий поток после короткого
+ * ожидания засыпает до завершения последней части и не отнимает ядро у рабочих потоков.
+ *
+ * Пул можно создать со своим кол-вом потоков или использовать общий пул Default().
+ * Пример: ThreadPool pool(3); list.ParallelCount(Element::SECRET_BOX, pool);  // 3 рабочих + вызывающий поток
+ */
+struct ThreadPool {
+ public:
+  // константы структуры
+  static constexpr int kDefaultGrainSize = 1 << 16;  // размер части диапазона по умолчанию (элементов на задачу)
+
+  /**
+   * Тело параллельного цикла: обработка части диапазона [begin, end).
+   * Вызывается одновременно из нескольких потоков для непересекающихся частей.
+   */
+  using RangeFunction = std::function<void(int begin, int end)>;
+
+ private:
+  struct Batch;
+
+  // задача: часть диапазона одного вызова ParallelFor
+  struct Task {
+    const RangeFunction *body;
+    int begin;
+    int end;
+    Batch *batch;
+  };
+
+  // очередь задач рабочего потока (или общая очередь внешних потоков)
+  struct TaskQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  // поля структуры
+  std::vector<std::unique_ptr<TaskQueue>> queues_;  // очереди рабочих потоков, последняя - для внешних потоков
+  std::vector<std::thread> workers_;
+
+  std::atomic<int> num_queued_{0};  // кол-во задач в очередях (еще не взятых на выполнение)
+  std::mutex sleep_mutex_;          // ожидание задач рабочими потоками
+  std::condition_variable wake_;
+  bool stopping_{false};
+
+ public:
+  /**
+   * Создание пула с указанным кол-вом рабочих потоков.
+   * Прим. при num_workers = 0 все задачи выполняет вызывающий поток.
+   *
+   * @param num_workers - кол-во рабочих потоков
+   * @throws invalid_argument при отрицательном кол-ве потоков
+   */
+  explicit ThreadPool(int num_workers);
+
+  // копирование и перемещение запрещены (рабочие потоки ссылаются на пул)
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  // деструктор (дожидается завершения рабочих потоков)
+  ~ThreadPool();
+
+  /**
+   * Общий пул: hardware_concurrency - 1 рабочих потоков (вызывающий поток - еще один исполнитель).
+   * Создается при первом обращении.
+   */
+  static ThreadPool &Default();
+
+  int GetNumWorkers() const;
+
+  /**
+   * Параллельный цикл по диапазону [begin, end) ~ O(n / p).
+   *
+   * Диапазон делится на части по grain элементов, части выполняются рабочими потоками и вызывающим потоком.
+   * Возврат происходит после завершения всех частей. Если тело цикла бросило исключение,
+   * оставшиеся части все равно выполняются, а первое исключение пробрасывается вызывающему.
+   *
+   * @param begin - начало диапазона
+   * @param end - конец диапазона (не включительно)
+   * @param grain - размер части диапазона
+   * @param body - тело цикла
+   * @throws invalid_argument при неположительном размере части
+   */
+  void ParallelFor(int begin, int end, int grain, const RangeFunction &body);
+
+ private:
+
+  // цикл рабочего потока с индексом index
+  void run_worker(int index);
+
+  /**
+   * Получение задачи: с конца своей очереди, иначе с начала чужой (перехват) ~ O(кол-во очередей).
+   *
+   * @param home - индекс очереди текущего потока
+   * @param task - полученная задача
+   * @return true, если задача получена
+   */
+  bool try_pop(int home, Task &task);
+
+  // выполнение задачи с учетом ее завершения в группе (Batch)
+  static void execute(const Task &task);
+
+  // индекс очереди текущего потока в этом пуле (очередь внешних потоков для потоков не из пула)
+  int home_queue() const;
+};
+
+}  // namespace itis
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <memory_resource>
+#include <ostream>
+#include <vector>
+
+#include "element.hpp"  // Element
+
+namespace itis {
+
+/**
+ * Структура "развернутый узел".
+ * Хранит в себе массив элементов фиксированной емкости и указатель на следующий узел.
+ * Узел занимает ровно одну кэш-линию (64 байта): 12 элементов + кол-во элементов + указатель.
+ */
+struct alignas(64) UnrolledNode {
+ public:
+  static constexpr int kCacheLineSize = 64;
+  static constexpr int kCapacity = 12;  // (64 - sizeof(count) - sizeof(next)) / sizeof(Element)
+
+  // поля структуры
+  int count{0};                 // кол-во элементов в узле
+  UnrolledNode *next{nullptr};  // следующий узел
+  Element data[kCapacity];      // элементы узла [0, count)
+};
+
+static_assert(sizeof(UnrolledNode) == UnrolledNode::kCacheLineSize, "UnrolledNode must fit into one cache line");
+
+/**
+ * Структура данных "развернутый связный список" (unrolled linked list).
+ *
+ * Интерфейс совпадает с LinkedList, но каждый узел хранит до B = UnrolledNode::kCapacity элементов.
+ * Обход списка (IndexOf, Count, operator<<) идет в основном по непрерывной памяти узла,
+ * промах кэша происходит один раз на узел, а не на элемент; поиск узла по индексу ~ O(n / B).
+ *
+ * Пример (B = 4):
+ * [1 2 3 x] -> [4 5 x x] -> [6 7 8 9] -> nullptr
+ *
+ * Инварианты:
+ *  - узлы не пустые;
+ *  - переполненный при вставке узел делится пополам (split);
+ *  - узел (кроме последнего), в котором после удаления осталось меньше B / 2 элементов,
+ *    сливается со следующим узлом или забирает у него часть элементов (merge),
+ *    поэтому узлов не больше 2n / B + 1.
+ */
+struct UnrolledLinkedList {
+ public:
+  static constexpr int kNotFoundElementIndex = -1;                    // индекс ненайденного элемента в списке
+  static constexpr int kElementsPerNode = UnrolledNode::kCapacity;    // емкость узла
+  static constexpr int kMinElementsPerNode = kElementsPerNode / 2;   // порог слияния узлов
+
+ private:
+  // поля структуры
+  int size_{0};                  // кол-во элементов в списке
+  int num_nodes_{0};             // кол-во узлов в списке
+  UnrolledNode *head_{nullptr};  // первый узел
+  UnrolledNode *tail_{nullptr};  // последний узел
+
+  // источник памяти под узлы (по умолчанию: глобальная куча через new/delete)
+  std::pmr::memory_resource *resource_{std::pmr::get_default_resource()};
+
+ public:
+  // конструктор по умолчанию
+  UnrolledLinkedList() = default;
+
+  /**
+   * Создание списка, выделяющего память под узлы через указанный источник памяти.
+   *
+   * @param resource - источник памяти
+   * @throws invalid_argument при передаче nullptr
+   */
+  explicit UnrolledLinkedList(std::pmr::memory_resource *resource);
+
+  // копирование запрещено, используйте Clone()
+  UnrolledLinkedList(const UnrolledLinkedList &) = delete;
+  UnrolledLinkedList &operator=(const UnrolledLinkedList &) = delete;
+
+  // перемещение ~ O(1), перемещенный список остается пустым
+  UnrolledLinkedList(UnrolledLinkedList &&other) noexcept;
+  UnrolledLinkedList &operator=(UnrolledLinkedList &&other) noexcept;
+
+  // деструктор
+  virtual ~UnrolledLinkedList();
+
+  void Swap(UnrolledLinkedList &other) noexcept;
+
+  // глубокая копия ~ O(n), узлы копии заполнены полностью
+  UnrolledLinkedList Clone() const;
+
+  /**
+   * Добавление элемента в конец списка ~ O(1).
+   *
+   * Элемент записывается в последний узел, новый узел создается только при заполненном последнем узле.
+   *
+   * @param e - значение элемента
+   */
+  void Add(Element e);
+
+  /**
+   * Вставка элемента в список по индексу ~ O(n / B + B).
+   *
+   * Элементы узла справа от позиции вставки сдвигаются внутри узла.
+   * Заполненный узел предварительно делится пополам:
+   * [1 2 3 4] => insert(1, 7) => [1 7 2 x] -> [3 4 x x] (B = 4)
+   *
+   * @param index - позиция для вставки элемента
+   * @param e - значение элемента
+   *
+   * @throws out_of_range при передаче индекса за пределами списка
+   */
+  void Insert(int index, Element e);
+
+  /**
+   * Изменение значения элемента списка по индексу ~ O(n / B).
+   *
+   * @throws out_of_range при передаче индекса за пределами списка
+   */
+  void Set(int index, Element e);
+
+  /**
+   * Удаление элемента списка по индексу ~ O(n / B + B).
+   *
+   * Опустевший узел удаляется, недозаполненный узел сливается со следующим узлом.
+   *
+   * @param index - индекс удаляемого элемента
+   * @return значение удаленного элемента
+   *
+   * @throws out_of_range при передаче индекса за пределами списка
+   */
+  Element Remove(int index);
+
+  // удаление всех элементов списка с высвобождением узлов ~ O(n / B)
+  void Clear();
+
+  /**
+   * Получение элемента списка по индексу ~ O(n / B).
+   *
+   * @throws out_of_range при передаче индекса за пределами списка
+   */
+  Element Get(int index) const;
+
+  /**
+   * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+   *
+   * @param e - значение элемента
+   * @return индекс элемента или -1 при остутствии элемента в списке
+   */
+  int IndexOf(Element e) const;
+
+  bool Contains(Element e) const;
+
+  int Count(Element e) const;
+
+  int GetSize() const;
+
+  bool IsEmpty() const;
+
+  // кол-во узлов в списке
+  int GetNumNodes() const;
+
+  Element tail() const;
+
+  Element head() const;
+
+  std::pmr::memory_resource *GetMemoryResource() const;
+
+ private:
+
+  // создание пустого узла в памяти источника памяти списка ~ O(1)
+  UnrolledNode *create_node(UnrolledNode *next);
+
+  // уничтожение узла, созданного create_node ~ O(1)
+  void destroy_node(UnrolledNode *node);
+
+  /**
+   * Поиск узла, содержащего элемент с указанным индексом ~ O(n / B).
+   *
+   * @param index - индекс элемента (0 <= index < size)
+   * @param offset - [out] индекс элемента внутри узла
+   * @param prev - [out] предыдущий узел (nullptr для первого узла), может быть nullptr
+   * @return указатель на узел
+   */
+  UnrolledNode *find_node(int index, int &offset, UnrolledNode **prev = nullptr) const;
+
+  // деление заполненного узла пополам: вторая половина переносится в новый узел после него
+  void split_node(UnrolledNode *node);
+
+  // восстановление инварианта для недозаполненного или пустого узла после удаления элемента
+  void rebalance_node(UnrolledNode *node, UnrolledNode *prev);
+
+  // исключение узла из цепочки и его уничтожение
+  void unlink_node(UnrolledNode *node, UnrolledNode *prev);
+
+ public:
+  // необходимо для тестирования
+  explicit UnrolledLinkedList(const std::vector<Element> &);
+  friend std::ostream &operator<<(std::ostream &, const UnrolledLinkedList &);
+  friend bool operator==(const UnrolledLinkedList &, const std::vector<Element> &);
+};
+
+inline void swap(UnrolledLinkedList &lhs, UnrolledLinkedList &rhs) noexcept {
+  lhs.Swap(rhs);
+}
+
+}  // namespace itis
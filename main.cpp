@@ -7,12 +7,12 @@ using namespace itis;
 using namespace std;
 
 int main(int argc, char **argv) {
-  auto linked_list = new LinkedList;
-//  linked_list->Add(Element::DRAGON_BALL);
-//  linked_list->Add(Element::CHERRY_PIE);
-//  linked_list->Add(Element::SECRET_BOX);
+  LinkedList linked_list;
+//  linked_list.Add(Element::DRAGON_BALL);
+//  linked_list.Add(Element::CHERRY_PIE);
+//  linked_list.Add(Element::SECRET_BOX);
 
 
-  cout << linked_list->IndexOf(Element::GRAVITY_GUN) << endl;
+  cout << linked_list.IndexOf(Element::GRAVITY_GUN) << endl;
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,280 @@
+#include "array_deque.hpp"
+
+#include <algorithm>  // copy, fill, min
+#include <cassert>    // assert
+#include <stdexcept>  // out_of_range, invalid_argument
+#include <utility>    // swap
+
+#include "private/element_search.hpp"  // векторный поиск элементов
+#include "private/internal.hpp"        // вспомогательные функции
+
+namespace itis {
+
+ArrayDeque::ArrayDeque() : ArrayDeque(kInitCapacity) {}
+
+ArrayDeque::ArrayDeque(int capacity, GrowthPolicy growth_policy, std::pmr::memory_resource *resource)
+    : growth_policy_{growth_policy}, resource_{resource} {
+  if (capacity <= 0) {
+    throw std::invalid_argument("ArrayDeque::capacity must be positive");
+  }
+  if (resource == nullptr) {
+    throw std::invalid_argument("ArrayDeque::resource must not be null");
+  }
+  resize(capacity);
+}
+
+ArrayDeque::ArrayDeque(ArrayDeque &&other) noexcept
+    : size_{other.size_},
+      capacity_{other.capacity_},
+      head_{other.head_},
+      data_{other.data_},
+      growth_policy_{other.growth_policy_},
+      resource_{other.resource_} {
+  other.size_ = 0;
+  other.capacity_ = 0;
+  other.head_ = 0;
+  other.data_ = nullptr;
+}
+
+ArrayDeque &ArrayDeque::operator=(ArrayDeque &&other) noexcept {
+  if (this != &other) {
+    ArrayDeque moved{std::move(other)};
+    Swap(moved);
+  }
+  return *this;
+}
+
+ArrayDeque::~ArrayDeque() {
+  if (data_ != nullptr) {
+    resource_->deallocate(data_, sizeof(Element) * capacity_, alignof(Element));
+  }
+  data_ = nullptr;
+  size_ = 0;
+  capacity_ = 0;
+  head_ = 0;
+}
+
+void ArrayDeque::Swap(ArrayDeque &other) noexcept {
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(head_, other.head_);
+  std::swap(data_, other.data_);
+  std::swap(growth_policy_, other.growth_policy_);
+  std::swap(resource_, other.resource_);
+}
+
+ArrayDeque ArrayDeque::Clone() const {
+  ArrayDeque clone(capacity_ > 0 ? capacity_ : kInitCapacity, growth_policy_, resource_);
+  for (int index = 0; index < size_; index++) {
+    clone.data_[index] = data_[physical(index)];
+  }
+  clone.size_ = size_;
+  return clone;
+}
+
+void ArrayDeque::Add(Element e) {
+  ensure_capacity(size_ + 1);
+  data_[physical(size_)] = e;
+  size_ += 1;
+}
+
+void ArrayDeque::AddLast(Element e) {
+  Add(e);
+}
+
+void ArrayDeque::AddFirst(Element e) {
+  ensure_capacity(size_ + 1);
+  head_ = physical(capacity_ - 1);  // head - 1 по модулю емкости
+  data_[head_] = e;
+  size_ += 1;
+}
+
+void ArrayDeque::Insert(int index, Element e) {
+  internal::check_out_of_range(index, 0, size_ + 1);
+  ensure_capacity(size_ + 1);
+
+  if (index < size_ / 2) {
+    // ближе к началу: элементы [0, index) сдвигаются на одну ячейку влево
+    head_ = physical(capacity_ - 1);
+    for (int current = 0; current < index; current++) {
+      data_[physical(current)] = data_[physical(current + 1)];
+    }
+  } else {
+    // ближе к концу: элементы [index, size) сдвигаются на одну ячейку вправо
+    for (int current = size_; current > index; current--) {
+      data_[physical(current)] = data_[physical(current - 1)];
+    }
+  }
+
+  data_[physical(index)] = e;
+  size_ += 1;
+}
+
+void ArrayDeque::Set(int index, Element value) {
+  internal::check_out_of_range(index, 0, size_);
+  data_[physical(index)] = value;
+}
+
+Element ArrayDeque::Remove(int index) {
+  internal::check_out_of_range(index, 0, size_);
+
+  const Element result = data_[physical(index)];
+
+  if (index < size_ / 2) {
+    // ближе к началу: элементы [0, index) сдвигаются на одну ячейку вправо
+    for (int current = index; current > 0; current--) {
+      data_[physical(current)] = data_[physical(current - 1)];
+    }
+    data_[head_] = Element::UNINITIALIZED;
+    head_ = physical(1);
+  } else {
+    // ближе к концу: элементы (index, size) сдвигаются на одну ячейку влево
+    for (int current = index; current < size_ - 1; current++) {
+      data_[physical(current)] = data_[physical(current + 1)];
+    }
+    data_[physical(size_ - 1)] = Element::UNINITIALIZED;
+  }
+
+  size_ -= 1;
+  return result;
+}
+
+Element ArrayDeque::RemoveFirst() {
+  return Remove(0);
+}
+
+Element ArrayDeque::RemoveLast() {
+  return Remove(size_ - 1);
+}
+
+void ArrayDeque::Clear() {
+  const int first_part = std::min(size_, capacity_ - head_);
+  std::fill(data_ + head_, data_ + head_ + first_part, Element::UNINITIALIZED);
+  std::fill(data_, data_ + (size_ - first_part), Element::UNINITIALIZED);
+  size_ = 0;
+  head_ = 0;
+}
+
+Element ArrayDeque::Get(int index) const {
+  internal::check_out_of_range(index, 0, size_);
+  return data_[physical(index)];
+}
+
+Element ArrayDeque::GetFirst() const {
+  return Get(0);
+}
+
+Element ArrayDeque::GetLast() const {
+  return Get(size_ - 1);
+}
+
+int ArrayDeque::IndexOf(Element e) const {
+  // [head, head + first_part) и [0, size - first_part)
+  const int first_part = std::min(size_, capacity_ - head_);
+
+  const int first = internal::index_of(data_ + head_, first_part, e);
+  if (first != kNotFoundElementIndex) return first;
+
+  const int second = internal::index_of(data_, size_ - first_part, e);
+  return second == kNotFoundElementIndex ? kNotFoundElementIndex : first_part + second;
+}
+
+int ArrayDeque::LastIndexOf(Element e) const {
+  const int first_part = std::min(size_, capacity_ - head_);
+
+  const int second = internal::last_index_of(data_, size_ - first_part, e);
+  if (second != kNotFoundElementIndex) return first_part + second;
+
+  return internal::last_index_of(data_ + head_, first_part, e);
+}
+
+bool ArrayDeque::Contains(Element e) const {
+  return IndexOf(e) != kNotFoundElementIndex;
+}
+
+int ArrayDeque::Count(Element e) const {
+  const int first_part = std::min(size_, capacity_ - head_);
+  return internal::count(data_ + head_, first_part, e) + internal::count(data_, size_ - first_part, e);
+}
+
+int ArrayDeque::GetSize() const {
+  return size_;
+}
+
+int ArrayDeque::GetCapacity() const {
+  return capacity_;
+}
+
+bool ArrayDeque::IsEmpty() const {
+  return size_ == 0;
+}
+
+GrowthPolicy ArrayDeque::GetGrowthPolicy() const {
+  return growth_policy_;
+}
+
+void ArrayDeque::SetGrowthPolicy(GrowthPolicy growth_policy) {
+  growth_policy_ = growth_policy;
+}
+
+std::pmr::memory_resource *ArrayDeque::GetMemoryResource() const {
+  return resource_;
+}
+
+int ArrayDeque::physical(int index) const {
+  const int cell = head_ + index;
+  return cell >= capacity_ ? cell - capacity_ : cell;  // дешевле, чем деление с остатком
+}
+
+void ArrayDeque::ensure_capacity(int min_capacity) {
+  if (min_capacity > capacity_) {
+    resize(growth_policy_.NextCapacity(capacity_, min_capacity));
+  }
+}
+
+void ArrayDeque::resize(int new_capacity) {
+  assert(new_capacity > capacity_);
+
+  auto *new_data = static_cast<Element *>(resource_->allocate(sizeof(Element) * new_capacity, alignof(Element)));
+
+  // элементы "разворачиваются" из кольца: [head, capacity) + [0, head + size - capacity)
+  const int first_part = std::min(size_, capacity_ - head_);
+  std::copy(data_ + head_, data_ + head_ + first_part, new_data);
+  std::copy(data_, data_ + (size_ - first_part), new_data + first_part);
+  std::fill(new_data + size_, new_data + new_capacity, Element::UNINITIALIZED);
+
+  if (data_ != nullptr) {
+    resource_->deallocate(data_, sizeof(Element) * capacity_, alignof(Element));
+  }
+
+  data_ = new_data;
+  capacity_ = new_capacity;
+  head_ = 0;
+}
+
+// === необходимо для тестирования ===
+
+std::ostream &operator<<(std::ostream &os, const ArrayDeque &deque) {
+  if (deque.data_ != nullptr) {
+    os << "{ ";
+    for (int index = 0; index < deque.capacity_ - 1; index++) {
+      os << internal::elem_to_str(deque.data_[deque.physical(index)]) << ", ";
+    }
+    os << internal::elem_to_str(deque.data_[deque.physical(deque.capacity_ - 1)]) << " }";
+  } else {
+    os << "{ nullptr }";
+  }
+  return os;
+}
+
+bool operator==(const ArrayDeque &deque, const std::vector<Element> &elements) {
+  if (deque.data_ == nullptr) return false;
+  if (deque.capacity_ != static_cast<int>(elements.size())) return false;
+
+  for (int index = 0; index < deque.capacity_; index++) {
+    if (deque.data_[deque.physical(index)] != elements.at(index)) return false;
+  }
+  return true;
+}
+
+}  // namespace itis
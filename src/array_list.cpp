@@ -1,25 +1,102 @@
 #include "array_list.hpp"  // подключаем заголовочный файл с объявлениями
 
-#include <algorithm>  // copy, fill
-#include <cassert>    // assert
-#include <stdexcept>  // out_of_range, invalid_argument
-
-#include "private/internal.hpp"  // вспомогательные функции
+#include <algorithm>   // copy, equal, fill, fill_n, for_each, max, min
+#include <array>       // array
+#include <atomic>      // atomic
+#include <cassert>     // assert
+#include <cstdint>     // uintptr_t
+#include <cstring>     // memmove
+#include <functional>  // less, greater
+#include <stdexcept>   // out_of_range, invalid_argument
+#include <utility>     // swap
+#include <vector>      // vector
+
+#include "private/element_search.hpp"  // векторный поиск элементов
+#include "private/internal.hpp"        // вспомогательные функции
 
 namespace itis {
 
-ArrayList::ArrayList(int capacity) : capacity_{capacity} {
+ArrayList::ArrayList(int capacity) : ArrayList(capacity, std::pmr::get_default_resource()) {}
+
+ArrayList::ArrayList(int capacity, std::pmr::memory_resource *resource)
+    : ArrayList(capacity, FillMode::EAGER, GrowthPolicy::Additive(kCapacityGrowthCoefficient), resource) {}
+
+ArrayList::ArrayList(int capacity, FillMode fill_mode, GrowthPolicy growth_policy, std::pmr::memory_resource *resource)
+    : capacity_{capacity}, growth_policy_{growth_policy}, resource_{resource}, fill_mode_{fill_mode} {
   if (capacity <= 0) {
     throw std::invalid_argument("ArrayList::capacity must be positive");
   }
-    data_ = new Element [capacity_];
-    std::fill(data_, data_ + capacity_, Element::UNINITIALIZED);
+  if (resource == nullptr) {
+    throw std::invalid_argument("ArrayList::resource must not be null");
+  }
+    data_ = allocate(capacity_);
+    if (fill_mode_ == FillMode::EAGER) {
+      std::fill(data_, data_ + capacity_, Element::UNINITIALIZED);
+      filled_ = capacity_;
+    }
   // Tip 1: используйте std::fill для заполнения выделенных ячеек массива значением Element::UNINITIALIZED
   // здесь должен быть ваш код ...
 }
 
+ArrayList::ArrayList(ArrayList &&other) noexcept
+    : size_{other.size_},
+      capacity_{other.capacity_},
+      data_{other.data_},
+      growth_policy_{other.growth_policy_},
+      resource_{other.resource_},
+      counts_{other.counts_},
+      fill_mode_{other.fill_mode_},
+      filled_{other.filled_},
+      shared_{other.shared_} {
+  other.counts_.on_clear();
+  other.filled_ = 0;
+  other.size_ = 0;
+  other.capacity_ = 0;
+  other.data_ = nullptr;
+  other.shared_ = nullptr;
+}
+
+ArrayList &ArrayList::operator=(ArrayList &&other) noexcept {
+  if (this != &other) {
+    ArrayList moved{std::move(other)};
+    Swap(moved);
+  }
+  return *this;
+}
+
+void ArrayList::Swap(ArrayList &other) noexcept {
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(data_, other.data_);
+  std::swap(growth_policy_, other.growth_policy_);
+  std::swap(resource_, other.resource_);
+  std::swap(counts_, other.counts_);
+  std::swap(fill_mode_, other.fill_mode_);
+  std::swap(filled_, other.filled_);
+  std::swap(shared_, other.shared_);
+}
+
+ArrayList ArrayList::Clone() const {
+  ArrayList clone(capacity_ > 0 ? capacity_ : kInitCapacity, fill_mode_, growth_policy_, resource_);
+  std::copy(data_, data_ + size_, clone.data_);
+  clone.size_ = size_;
+  clone.filled_ = std::max(clone.filled_, size_);
+  clone.counts_ = counts_;
+  return clone;
+}
+
+ArrayListSnapshot ArrayList::Snapshot() const {
+  if (data_ == nullptr) return {};
+
+  // первый снимок: буфер переходит под управление счетчика владельцев (массив - первый владелец)
+  if (shared_ == nullptr) {
+    shared_ = internal::SharedElements::create(data_, capacity_, resource_);
+  }
+  return {shared_, data_, size_};
+}
+
 ArrayList::~ArrayList() {
-    delete [] data_;
+    release_data();
     data_ = nullptr;
     size_ = 0;
     capacity_ = 0;
@@ -32,13 +109,16 @@ void ArrayList::Add(Element e) {
   // здесь должен быть ваш код ...
 
   if(size_ == capacity_){
-      resize(capacity_ + kCapacityGrowthCoefficient);
+      grow(size_ + 1);
   }
 
   assert(size_ < capacity_);  // я здесь, чтобы не дать тебе сойти с правильного пути
 
+  detach();
   data_[size_] = e;
   size_ += 1;
+  filled_ = std::max(filled_, size_);
+  counts_.on_add(e);
   // напишите свой код после расширения емкости массива здесь ...
 }
 
@@ -51,7 +131,7 @@ void ArrayList::Insert(int index, Element e) {
   // Tip 1: используйте метод resize(new_capacity) для расширения емкости массива
   // напишите свой код здесь ...
 
-  if(size_ == capacity_) resize(capacity_ + kCapacityGrowthCoefficient);
+  if(size_ == capacity_) grow(size_ + 1);
 
   assert(size_ < capacity_);  // я ни в коем случае не дам вам совершить ошибку всей вашей жизни
 
@@ -60,28 +140,75 @@ void ArrayList::Insert(int index, Element e) {
   else if(index == size_) Add(e);
 
   else {
+      detach();
       std::copy(data_ + index, data_ + size_, data_ + index + 1);
 
       size_ += 1;
       data_[index] = e;
+      filled_ = std::max(filled_, size_);
+      counts_.on_add(e);
   }
 
   // Tip 2: для свдига элементов вправо можете использовать std::copy
   // напишите свой код после расширения емкости массива здесь ...
 }
 
+void ArrayList::AddRange(const Element *elements, int count) {
+  if (count < 0) {
+    throw std::invalid_argument("ArrayList::count must not be negative");
+  }
+  InsertRange(size_, elements, elements + count);
+}
+
+void ArrayList::InsertRange(int index, const Element *first, const Element *last) {
+  internal::check_out_of_range(index, 0, size_ + 1);
+
+  if (first > last) {
+    throw std::invalid_argument("ArrayList::range must not be reversed");
+  }
+
+  const auto count = static_cast<int>(last - first);
+  if (count == 0) return;
+
+  // std::less/std::greater задают полный порядок и для указателей в разные массивы (встроенные < и > - нет)
+  if (std::less<const Element *>{}(first, data_ + capacity_) && std::greater<const Element *>{}(last, data_)) {
+    // вставляем часть самого себя: буфер может переехать или сдвинуться, поэтому сначала копируем
+    const std::vector<Element> elements(first, last);
+    InsertRange(index, elements.data(), elements.data() + count);
+    return;
+  }
+
+  ensure_capacity(size_ + count);
+  detach();
+
+  // один сдвиг хвоста вместо count сдвигов по одному элементу
+  std::memmove(data_ + index + count, data_ + index, sizeof(Element) * (size_ - index));
+  std::memcpy(data_ + index, first, sizeof(Element) * count);
+
+  size_ += count;
+  filled_ = std::max(filled_, size_);
+
+  if (counts_.enabled()) {
+    std::for_each(first, last, [this](Element e) { counts_.on_add(e); });
+  }
+}
+
 void ArrayList::Set(int index, Element value) {
   internal::check_out_of_range(index, 0, size_);
   // напишите свой код здесь ...
+  detach();
+  counts_.on_set(data_[index], value);
   data_[index] = value;
 }
 
 Element ArrayList::Remove(int index) {
   internal::check_out_of_range(index, 0, size_);
+  detach();
   Element result = data_[index];
   std::copy(data_ + index + 1, data_ + size_, data_ + index);
   size_ -= 1;
   data_[size_] = Element::UNINITIALIZED;
+  counts_.on_remove(result);
   // Tip 1: можете использовать std::copy для сдвига элементов влево
   // Tip 2: не забудьте задать значение Element::UNINITIALIZED освободившейся ячейке
   // напишите свой код здесь ...
@@ -89,9 +216,68 @@ Element ArrayList::Remove(int index) {
   return result;
 }
 
+void ArrayList::RemoveRange(int from, int to) {
+  internal::check_out_of_range(from, 0, size_ + 1);
+  internal::check_out_of_range(to, from, size_ + 1);
+
+  const int count = to - from;
+  if (count == 0) return;
+
+  detach();
+
+  if (counts_.enabled()) {
+    std::for_each(data_ + from, data_ + to, [this](Element e) { counts_.on_remove(e); });
+  }
+
+  std::memmove(data_ + from, data_ + to, sizeof(Element) * (size_ - to));
+  std::fill(data_ + size_ - count, data_ + size_, Element::UNINITIALIZED);
+
+  size_ -= count;
+}
+
+void ArrayList::Sort() {
+  detach();
+
+  // 1. гистограмма значений
+  std::array<int, kNumElementValues> histogram{};
+  if (counts_.enabled()) {
+    for (int value = 0; value < kNumElementValues; value++) {
+      histogram[value] = counts_.count(static_cast<Element>(value));
+    }
+  } else {
+    std::for_each(data_, data_ + size_, [&histogram](Element e) { histogram[static_cast<int>(e)] += 1; });
+  }
+
+  // 2. заполнение массива значениями в порядке возрастания
+  Element *output = data_;
+  for (int value = 0; value < kNumElementValues; value++) {
+    output = std::fill_n(output, histogram[value], static_cast<Element>(value));
+  }
+}
+
+void ArrayList::StableSort() {
+  Sort();
+}
+
 void ArrayList::Clear() {
+  if (shared_ != nullptr && !shared_->unique()) {
+    // буфер делят снимки: вместо копирования стираемых элементов (detach) берется новый пустой буфер
+    auto *new_data = allocate(capacity_);
+    release_data();
+    data_ = new_data;
+
+    if (fill_mode_ == FillMode::EAGER) {
+      std::fill(data_, data_ + capacity_, Element::UNINITIALIZED);
+      filled_ = capacity_;
+    } else {
+      filled_ = 0;
+    }
+  } else {
+    detach();
     std::fill(data_, data_ + size_, Element::UNINITIALIZED);
-    size_ = 0;
+  }
+  size_ = 0;
+  counts_.on_clear();
   // Tip 1: можете использовать std::fill для заполнения ячеек массива значением  Element::UNINITIALIZED
   // напишите свой код здесь ...
 }
@@ -103,23 +289,129 @@ Element ArrayList::Get(int index) const {
 }
 
 int ArrayList::IndexOf(Element e) const {
-  // напишите свой код здесь ...
-  for(int i = 0; i < size_; i ++){
-      if(data_[i] == e) return i;
-  }
-  return kNotFoundElementIndex;
+  if (counts_.enabled() && counts_.count(e) == 0) return kNotFoundElementIndex;
+  return internal::index_of(data_, size_, e);
+}
+
+int ArrayList::LastIndexOf(Element e) const {
+  if (counts_.enabled() && counts_.count(e) == 0) return kNotFoundElementIndex;
+  return internal::last_index_of(data_, size_, e);
+}
+
+int ArrayList::Count(Element e) const {
+  if (counts_.enabled()) return counts_.count(e);
+  return internal::count(data_, size_, e);
 }
 
 // === РЕАЛИЗОВАНО ===
 
 bool ArrayList::Contains(Element e) const {
   // здесь был Рамиль
+  if (counts_.enabled()) return counts_.count(e) > 0;
   return IndexOf(e) != kNotFoundElementIndex;
 }
 
 // это делегирующий конструктор если что
 ArrayList::ArrayList() : ArrayList(kInitCapacity) {}
 
+ArrayList::ArrayList(int capacity, GrowthPolicy growth_policy) : ArrayList(capacity) {
+  growth_policy_ = growth_policy;
+}
+
+ArrayList::ArrayList(std::pmr::memory_resource *resource) : ArrayList(kInitCapacity, resource) {}
+
+ArrayList::ArrayList(int capacity, GrowthPolicy growth_policy, std::pmr::memory_resource *resource)
+    : ArrayList(capacity, resource) {
+  growth_policy_ = growth_policy;
+}
+
+int ArrayList::ParallelCount(Element e, ThreadPool &pool) const {
+  if (counts_.enabled()) return counts_.count(e);
+
+  std::atomic<int> result{0};
+  pool.ParallelFor(0, size_, ThreadPool::kDefaultGrainSize, [this, e, &result](int begin, int end) {
+    result.fetch_add(internal::count(data_ + begin, end - begin, e), std::memory_order_relaxed);
+  });
+  return result.load(std::memory_order_relaxed);
+}
+
+int ArrayList::ParallelIndexOf(Element e, ThreadPool &pool) const {
+  if (counts_.enabled() && counts_.count(e) == 0) return kNotFoundElementIndex;
+
+  // наименьший найденный индекс (size_ - не найден)
+  std::atomic<int> found{size_};
+  pool.ParallelFor(0, size_, ThreadPool::kDefaultGrainSize, [this, e, &found](int begin, int end) {
+    // досрочная отмена: вхождение уже найдено левее этой части
+    if (found.load(std::memory_order_relaxed) < begin) return;
+
+    const int index = internal::index_of(data_ + begin, end - begin, e);
+    if (index == kNotFoundElementIndex) return;
+
+    int current = found.load(std::memory_order_relaxed);
+    while (begin + index < current && !found.compare_exchange_weak(current, begin + index, std::memory_order_relaxed)) {
+    }
+  });
+
+  const int index = found.load(std::memory_order_relaxed);
+  return index < size_ ? index : kNotFoundElementIndex;
+}
+
+int ArrayList::ParallelReplace(Element old_value, Element new_value, ThreadPool &pool) {
+  if (counts_.enabled() && counts_.count(old_value) == 0) return 0;
+
+  detach();
+
+  constexpr int kCacheLineSize = 64;
+  constexpr int kLineSize = kCacheLineSize / static_cast<int>(sizeof(Element));  // элементов в кэш-линии
+  static_assert(ThreadPool::kDefaultGrainSize % kLineSize == 0, "part must consist of whole cache lines");
+
+  // индексы частей отсчитываются от начала кэш-линии с data_[0] (head ячеек перед ним массиву не принадлежат):
+  // границы частей и блоков совпадают с границами кэш-линий, поэтому соседние части не пишут в одну линию,
+  // а замена в блоке затрагивает ровно одну линию
+  const int head =
+      static_cast<int>(reinterpret_cast<std::uintptr_t>(data_) % kCacheLineSize) / static_cast<int>(sizeof(Element));
+
+  std::atomic<int> result{0};
+  const auto replace = [this, old_value, new_value, head, &result](int begin, int end) {
+    begin = std::max(begin, 0);
+
+    // часть без вхождений только читается (векторный поиск); дальше запись идет только в кэш-линии с вхождениями,
+    // поэтому проход остается ограничен чтением памяти, а строки без вхождений не становятся "грязными"
+    const int first = internal::index_of(data_ + begin, end - begin, old_value);
+    if (first == kNotFoundElementIndex) return;
+
+    int num_replaced = 0;
+    for (int line = begin + first - (begin + first + head) % kLineSize; line < end; line += kLineSize) {
+      const int block_begin = std::max(line, begin);
+      const int block_size = std::min(line + kLineSize, end) - block_begin;
+      Element *cells = data_ + block_begin;
+
+      // подсчет и замена без ветвлений (векторизуются), замена - только при вхождениях в кэш-линии
+      const auto replace_block = [cells, old_value, new_value](int size) {
+        int num_matches = 0;
+        for (int offset = 0; offset < size; offset++) {
+          num_matches += cells[offset] == old_value ? 1 : 0;
+        }
+        if (num_matches == 0) return 0;
+
+        for (int offset = 0; offset < size; offset++) {
+          cells[offset] = cells[offset] == old_value ? new_value : cells[offset];
+        }
+        return num_matches;
+      };
+
+      // целая линия (все блоки, кроме крайних в части) обрабатывается с постоянной длиной: циклы разворачиваются
+      num_replaced += block_size == kLineSize ? replace_block(kLineSize) : replace_block(block_size);
+    }
+    result.fetch_add(num_replaced, std::memory_order_relaxed);
+  };
+  pool.ParallelFor(-head, size_, ThreadPool::kDefaultGrainSize, replace);
+
+  const int num_replaced = result.load(std::memory_order_relaxed);
+  counts_.on_replace(old_value, new_value, num_replaced);
+  return num_replaced;
+}
+
 int ArrayList::GetSize() const {
   return size_;
 }
@@ -132,6 +424,66 @@ bool ArrayList::IsEmpty() const {
   return size_ == 0;
 }
 
+GrowthPolicy ArrayList::GetGrowthPolicy() const {
+  return growth_policy_;
+}
+
+void ArrayList::SetGrowthPolicy(GrowthPolicy growth_policy) {
+  growth_policy_ = growth_policy;
+}
+
+std::pmr::memory_resource *ArrayList::GetMemoryResource() const {
+  return resource_;
+}
+
+ArrayList::FillMode ArrayList::GetFillMode() const {
+  return fill_mode_;
+}
+
+void ArrayList::Reserve(int capacity) {
+  if (capacity > capacity_) resize(capacity);
+}
+
+void ArrayList::materialize() const {
+  if (filled_ < capacity_) {
+    std::fill(data_ + filled_, data_ + capacity_, Element::UNINITIALIZED);
+    filled_ = capacity_;
+  }
+}
+
+Element *ArrayList::allocate(int capacity) const {
+  return static_cast<Element *>(resource_->allocate(sizeof(Element) * capacity, alignof(Element)));
+}
+
+void ArrayList::deallocate(Element *data, int capacity) const {
+  if (data != nullptr) {
+    resource_->deallocate(data, sizeof(Element) * capacity, alignof(Element));
+  }
+}
+
+void ArrayList::EnableElementCounts() {
+  if (counts_.enabled()) return;
+
+  counts_.enable();
+  std::for_each(data_, data_ + size_, [this](Element e) { counts_.on_add(e); });
+}
+
+void ArrayList::DisableElementCounts() {
+  counts_.disable();
+}
+
+bool ArrayList::HasElementCounts() const {
+  return counts_.enabled();
+}
+
+void ArrayList::grow(int min_capacity) {
+  resize(growth_policy_.NextCapacity(capacity_, min_capacity));
+}
+
+void ArrayList::ensure_capacity(int min_capacity) {
+  if (min_capacity > capacity_) grow(min_capacity);
+}
+
 // Легенда: давным давно на планете под названием Земля жил да был Аватар...
 // Аватар мог управлять четырьмя стихиями, но никак не мог совладать с C++ (фейспалм).
 // Помогите найти непростительную ошибку Аватара,
@@ -141,16 +493,23 @@ void ArrayList::resize(int new_capacity) {
   assert(new_capacity > capacity_);  // не ошибается тот, кто ничего не делает ...
 
   // 1. выделяем новый участок памяти
-  auto *new_data = new Element [new_capacity];
+  auto *new_data = allocate(new_capacity);
 
   // 2. копируем данные на новый участок
   std::copy(data_, data_ + size_, new_data);
+  internal::count_operation(internal::Operation::RESIZE);
+  internal::count_operation(internal::Operation::RESIZE_BYTE_COPIED, static_cast<long long>(sizeof(Element)) * size_);
 
-  // 3. заполняем "свободные" ячейки памяти значением Element::UNINITIALIZED
-  std::fill(new_data + size_, new_data + new_capacity, Element::UNINITIALIZED);
+  // 3. заполняем "свободные" ячейки памяти значением Element::UNINITIALIZED (в ленивом режиме - при наблюдении)
+  if (fill_mode_ == FillMode::EAGER) {
+    std::fill(new_data + size_, new_data + new_capacity, Element::UNINITIALIZED);
+    filled_ = new_capacity;
+  } else {
+    filled_ = size_;
+  }
 
-  // 4. высвобождаем старый участок памяти меньшего размера
-  delete [] data_;
+  // 4. высвобождаем старый участок памяти меньшего размера (если его читают снимки - освободит последний из них)
+  release_data();
 
   // 5. пересылаем указатель на новый участок памяти
   data_ = new_data;
@@ -159,13 +518,128 @@ void ArrayList::resize(int new_capacity) {
   capacity_ = new_capacity;
 }
 
+void ArrayList::detach() {
+  if (shared_ == nullptr) return;
+
+  // снимков не осталось: буфер снова принадлежит только массиву
+  if (shared_->unique()) {
+    internal::SharedElements::destroy(shared_);
+    shared_ = nullptr;
+    return;
+  }
+
+  auto *new_data = allocate(capacity_);
+  std::copy(data_, data_ + size_, new_data);
+
+  if (fill_mode_ == FillMode::EAGER) {
+    std::fill(new_data + size_, new_data + capacity_, Element::UNINITIALIZED);
+    filled_ = capacity_;
+  } else {
+    filled_ = size_;
+  }
+
+  internal::SharedElements::release(shared_);
+  shared_ = nullptr;
+  data_ = new_data;
+}
+
+void ArrayList::release_data() {
+  if (shared_ != nullptr) {
+    internal::SharedElements::release(shared_);
+    shared_ = nullptr;
+  } else {
+    deallocate(data_, capacity_);
+  }
+}
+
+// === ArrayListSnapshot ===
+
+ArrayListSnapshot::ArrayListSnapshot(internal::SharedElements *shared, const Element *data, int size)
+    : shared_{shared}, data_{data}, size_{size} {
+  shared_->acquire();
+}
+
+ArrayListSnapshot::ArrayListSnapshot(const ArrayListSnapshot &other)
+    : shared_{other.shared_}, data_{other.data_}, size_{other.size_} {
+  if (shared_ != nullptr) shared_->acquire();
+}
+
+ArrayListSnapshot &ArrayListSnapshot::operator=(const ArrayListSnapshot &other) {
+  ArrayListSnapshot copy{other};
+  Swap(copy);
+  return *this;
+}
+
+ArrayListSnapshot::ArrayListSnapshot(ArrayListSnapshot &&other) noexcept
+    : shared_{other.shared_}, data_{other.data_}, size_{other.size_} {
+  other.shared_ = nullptr;
+  other.data_ = nullptr;
+  other.size_ = 0;
+}
+
+ArrayListSnapshot &ArrayListSnapshot::operator=(ArrayListSnapshot &&other) noexcept {
+  if (this != &other) {
+    ArrayListSnapshot moved{std::move(other)};
+    Swap(moved);
+  }
+  return *this;
+}
+
+ArrayListSnapshot::~ArrayListSnapshot() {
+  if (shared_ != nullptr) internal::SharedElements::release(shared_);
+}
+
+void ArrayListSnapshot::Swap(ArrayListSnapshot &other) noexcept {
+  std::swap(shared_, other.shared_);
+  std::swap(data_, other.data_);
+  std::swap(size_, other.size_);
+}
+
+Element ArrayListSnapshot::Get(int index) const {
+  internal::check_out_of_range(index, 0, size_);
+  return data_[index];
+}
+
+int ArrayListSnapshot::IndexOf(Element e) const {
+  return internal::index_of(data_, size_, e);
+}
+
+int ArrayListSnapshot::LastIndexOf(Element e) const {
+  return internal::last_index_of(data_, size_, e);
+}
+
+bool ArrayListSnapshot::Contains(Element e) const {
+  return IndexOf(e) != ArrayList::kNotFoundElementIndex;
+}
+
+int ArrayListSnapshot::Count(Element e) const {
+  return internal::count(data_, size_, e);
+}
+
+int ArrayListSnapshot::GetSize() const {
+  return size_;
+}
+
+bool ArrayListSnapshot::IsEmpty() const {
+  return size_ == 0;
+}
+
+const Element *ArrayListSnapshot::begin() const {
+  return data_;
+}
+
+const Element *ArrayListSnapshot::end() const {
+  return data_ + size_;
+}
+
 // === ЗОНА 51: необходимо для тестирования ===
 
 ArrayList::ArrayList(Element *data, int size, int capacity) : size_{size}, capacity_{capacity} {
   assert(capacity > 0 && size >= 0 && size <= capacity);
 
-  data_ = new Element[capacity];
+  data_ = allocate(capacity);
   std::fill(data_, data_ + capacity, Element::UNINITIALIZED);
+  filled_ = capacity;
 
   if (data != nullptr) {
     std::copy(data, data + size, data_);
@@ -174,6 +648,7 @@ ArrayList::ArrayList(Element *data, int size, int capacity) : size_{size}, capac
 
 std::ostream &operator<<(std::ostream &os, const ArrayList &list) {
   if (list.data_ != nullptr) {
+    list.materialize();
     os << "{ ";
     for (int index = 0; index < list.capacity_ - 1; index++) {
       os << internal::elem_to_str(list.data_[index]) << ", ";
@@ -189,10 +664,16 @@ bool operator==(const ArrayList &list, const std::vector<Element> &elements) {
   if (list.data_ == nullptr) return false;
   if (list.capacity_ != static_cast<int>(elements.size())) return false;
 
+  list.materialize();
+
   for (int index = 0; index < list.capacity_; index++) {
     if (list.data_[index] != elements.at(index)) return false;
   }
   return true;
 }
 
+bool operator==(const ArrayListSnapshot &snapshot, const std::vector<Element> &elements) {
+  return std::equal(snapshot.begin(), snapshot.end(), elements.begin(), elements.end());
+}
+
 }  // namespace itis
\ No newline at end of file
@@ -0,0 +1,359 @@
+#include "compact_linked_list.hpp"
+
+#include <algorithm>  // copy, max
+#include <cassert>    // assert
+#include <cstring>    // memcpy
+#include <stdexcept>  // out_of_range, invalid_argument
+#include <utility>    // swap
+
+#include "private/internal.hpp"  // вспомогательные функции
+
+namespace itis {
+
+CompactLinkedList::CompactLinkedList(GrowthPolicy growth_policy, std::pmr::memory_resource *resource)
+    : growth_policy_{growth_policy}, resource_{resource} {
+  if (resource == nullptr) {
+    throw std::invalid_argument("CompactLinkedList::resource must not be null");
+  }
+}
+
+CompactLinkedList::CompactLinkedList(CompactLinkedList &&other) noexcept
+    : size_{other.size_},
+      capacity_{other.capacity_},
+      num_slots_used_{other.num_slots_used_},
+      head_{other.head_},
+      tail_{other.tail_},
+      free_list_{other.free_list_},
+      compact_{other.compact_},
+      next_{other.next_},
+      data_{other.data_},
+      growth_policy_{other.growth_policy_},
+      resource_{other.resource_} {
+  other.size_ = 0;
+  other.capacity_ = 0;
+  other.num_slots_used_ = 0;
+  other.head_ = kNullIndex;
+  other.tail_ = kNullIndex;
+  other.free_list_ = kNullIndex;
+  other.compact_ = true;
+  other.next_ = nullptr;
+  other.data_ = nullptr;
+}
+
+CompactLinkedList &CompactLinkedList::operator=(CompactLinkedList &&other) noexcept {
+  if (this != &other) {
+    CompactLinkedList moved{std::move(other)};
+    Swap(moved);
+  }
+  return *this;
+}
+
+CompactLinkedList::~CompactLinkedList() {
+  deallocate(next_, capacity_);
+}
+
+void CompactLinkedList::Swap(CompactLinkedList &other) noexcept {
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(num_slots_used_, other.num_slots_used_);
+  std::swap(head_, other.head_);
+  std::swap(tail_, other.tail_);
+  std::swap(free_list_, other.free_list_);
+  std::swap(compact_, other.compact_);
+  std::swap(next_, other.next_);
+  std::swap(data_, other.data_);
+  std::swap(growth_policy_, other.growth_policy_);
+  std::swap(resource_, other.resource_);
+}
+
+CompactLinkedList CompactLinkedList::Clone() const {
+  CompactLinkedList clone(growth_policy_, resource_);
+
+  if (capacity_ > 0) {
+    // индексы не зависят от адреса блока: достаточно побайтовой копии
+    clone.next_ = clone.allocate(capacity_);
+    clone.data_ = reinterpret_cast<std::uint8_t *>(clone.next_ + capacity_);
+    std::memcpy(clone.next_, next_, static_cast<std::size_t>(capacity_) * kBytesPerNode);
+  }
+
+  clone.size_ = size_;
+  clone.capacity_ = capacity_;
+  clone.num_slots_used_ = num_slots_used_;
+  clone.head_ = head_;
+  clone.tail_ = tail_;
+  clone.free_list_ = free_list_;
+  clone.compact_ = compact_;
+  return clone;
+}
+
+void CompactLinkedList::Add(Element e) {
+  const std::uint32_t slot = allocate_slot(e, kNullIndex);
+
+  if (tail_ == kNullIndex) {
+    head_ = slot;
+  } else {
+    next_[tail_] = slot;
+  }
+  tail_ = slot;
+
+  // i-й элемент по-прежнему в i-м слоте, если новый узел занял слот с номером size
+  if (compact_ && slot != static_cast<std::uint32_t>(size_)) compact_ = false;
+  size_ += 1;
+}
+
+void CompactLinkedList::Insert(int index, Element e) {
+  internal::check_out_of_range(index, 0, size_ + 1);
+
+  if (index == size_) {
+    Add(e);
+    return;
+  }
+
+  if (index == 0) {
+    head_ = allocate_slot(e, head_);
+  } else {
+    const std::uint32_t prev = find_slot(index - 1);
+    const std::uint32_t slot = allocate_slot(e, next_[prev]);  // блок мог переехать, индекс prev остается верным
+    next_[prev] = slot;
+  }
+
+  compact_ = false;
+  size_ += 1;
+}
+
+void CompactLinkedList::Set(int index, Element e) {
+  internal::check_out_of_range(index, 0, size_);
+  data_[find_slot(index)] = static_cast<std::uint8_t>(e);
+}
+
+Element CompactLinkedList::Remove(int index) {
+  internal::check_out_of_range(index, 0, size_);
+
+  std::uint32_t slot = kNullIndex;
+
+  if (index == 0) {
+    slot = head_;
+    head_ = next_[slot];
+    if (head_ == kNullIndex) tail_ = kNullIndex;
+  } else {
+    const std::uint32_t prev = find_slot(index - 1);
+    slot = next_[prev];
+    next_[prev] = next_[slot];
+    if (slot == tail_) tail_ = prev;
+  }
+
+  // удаление с конца не нарушает порядок слотов
+  if (index != size_ - 1) compact_ = false;
+
+  const auto result = static_cast<Element>(data_[slot]);
+  free_slot(slot);
+  size_ -= 1;
+  return result;
+}
+
+void CompactLinkedList::Clear() {
+  // блок не освобождается и не обходится: все слоты снова считаются нетронутыми
+  size_ = 0;
+  num_slots_used_ = 0;
+  head_ = kNullIndex;
+  tail_ = kNullIndex;
+  free_list_ = kNullIndex;
+  compact_ = true;
+}
+
+Element CompactLinkedList::Get(int index) const {
+  internal::check_out_of_range(index, 0, size_);
+  return static_cast<Element>(data_[find_slot(index)]);
+}
+
+void CompactLinkedList::Compact() {
+  if (!compact_ && size_ > 0) {
+    std::uint32_t *new_next = allocate(capacity_);
+    auto *new_data = reinterpret_cast<std::uint8_t *>(new_next + capacity_);
+
+    // проходим список и раскладываем узлы по слотам подряд
+    std::uint32_t slot = head_;
+    for (std::uint32_t index = 0; index < static_cast<std::uint32_t>(size_); index++) {
+      new_data[index] = data_[slot];
+      new_next[index] = index + 1;
+      slot = next_[slot];
+    }
+    new_next[size_ - 1] = kNullIndex;
+
+    deallocate(next_, capacity_);
+    next_ = new_next;
+    data_ = new_data;
+
+    head_ = 0;
+    tail_ = static_cast<std::uint32_t>(size_ - 1);
+  }
+
+  // свободные слоты за последним узлом снова считаются нетронутыми
+  num_slots_used_ = size_;
+  free_list_ = kNullIndex;
+  compact_ = true;
+}
+
+bool CompactLinkedList::IsCompact() const {
+  return compact_;
+}
+
+int CompactLinkedList::IndexOf(Element e) const {
+  const auto value = static_cast<std::uint8_t>(e);
+
+  int index = 0;
+  for (std::uint32_t slot = head_; slot != kNullIndex; slot = next_[slot], index++) {
+    if (data_[slot] == value) return index;
+  }
+  return kNotFoundElementIndex;
+}
+
+bool CompactLinkedList::Contains(Element e) const {
+  return IndexOf(e) != kNotFoundElementIndex;
+}
+
+int CompactLinkedList::Count(Element e) const {
+  const auto value = static_cast<std::uint8_t>(e);
+
+  int result = 0;
+  for (std::uint32_t slot = head_; slot != kNullIndex; slot = next_[slot]) {
+    result += data_[slot] == value ? 1 : 0;
+  }
+  return result;
+}
+
+int CompactLinkedList::GetSize() const {
+  return size_;
+}
+
+int CompactLinkedList::GetCapacity() const {
+  return capacity_;
+}
+
+bool CompactLinkedList::IsEmpty() const {
+  return size_ == 0;
+}
+
+Element CompactLinkedList::tail() const {
+  return tail_ != kNullIndex ? static_cast<Element>(data_[tail_]) : Element::UNINITIALIZED;
+}
+
+Element CompactLinkedList::head() const {
+  return head_ != kNullIndex ? static_cast<Element>(data_[head_]) : Element::UNINITIALIZED;
+}
+
+std::pmr::memory_resource *CompactLinkedList::GetMemoryResource() const {
+  return resource_;
+}
+
+std::uint32_t *CompactLinkedList::allocate(int capacity) const {
+  const std::size_t bytes = static_cast<std::size_t>(capacity) * kBytesPerNode;
+  return static_cast<std::uint32_t *>(resource_->allocate(bytes, alignof(std::uint32_t)));
+}
+
+void CompactLinkedList::deallocate(std::uint32_t *block, int capacity) const {
+  if (block != nullptr) {
+    resource_->deallocate(block, static_cast<std::size_t>(capacity) * kBytesPerNode, alignof(std::uint32_t));
+  }
+}
+
+void CompactLinkedList::resize(int new_capacity) {
+  assert(new_capacity > capacity_);
+
+  std::uint32_t *new_next = allocate(new_capacity);
+  auto *new_data = reinterpret_cast<std::uint8_t *>(new_next + new_capacity);
+
+  // номера слотов сохраняются, поэтому связи переносятся без изменений
+  std::copy(next_, next_ + num_slots_used_, new_next);
+  std::copy(data_, data_ + num_slots_used_, new_data);
+
+  deallocate(next_, capacity_);
+  next_ = new_next;
+  data_ = new_data;
+  capacity_ = new_capacity;
+}
+
+std::uint32_t CompactLinkedList::allocate_slot(Element e, std::uint32_t next) {
+  std::uint32_t slot = free_list_;
+
+  if (slot != kNullIndex) {
+    // 1. повторно используем освобожденный слот
+    free_list_ = next_[slot];
+  } else {
+    // 2. берем следующий нетронутый слот, при необходимости расширяя блок
+    if (num_slots_used_ == capacity_) {
+      resize(growth_policy_.NextCapacity(capacity_, std::max(capacity_ + 1, kInitCapacity)));
+    }
+    slot = static_cast<std::uint32_t>(num_slots_used_);
+    num_slots_used_ += 1;
+  }
+
+  next_[slot] = next;
+  data_[slot] = static_cast<std::uint8_t>(e);
+  return slot;
+}
+
+void CompactLinkedList::free_slot(std::uint32_t slot) {
+  next_[slot] = free_list_;
+  free_list_ = slot;
+}
+
+std::uint32_t CompactLinkedList::find_slot(int index) const {
+  assert(index >= 0 && index < size_);
+
+  if (compact_) return static_cast<std::uint32_t>(index);
+  if (index == size_ - 1) return tail_;
+
+  std::uint32_t slot = head_;
+  for (int counter = 0; counter < index; counter++) {
+    slot = next_[slot];
+  }
+  return slot;
+}
+
+// === необходимо для тестирования ===
+
+CompactLinkedList::CompactLinkedList(const std::vector<Element> &elements) {
+  for (const auto e : elements) {
+    Add(e);
+  }
+}
+
+std::ostream &operator<<(std::ostream &os, const CompactLinkedList &list) {
+  if (list.head_ != CompactLinkedList::kNullIndex) {
+    os << "{ ";
+    for (std::uint32_t slot = list.head_; slot != CompactLinkedList::kNullIndex; slot = list.next_[slot]) {
+      os << internal::elem_to_str(static_cast<Element>(list.data_[slot]))
+         << (slot == list.tail_ ? " }" : ", ");
+    }
+  } else {
+    os << "{ nullptr }";
+  }
+  return os;
+}
+
+bool operator==(const CompactLinkedList &list, const std::vector<Element> &elements) {
+  if (list.size_ != static_cast<int>(elements.size())) return false;
+
+  std::uint32_t slot = list.head_;
+  std::uint32_t last = CompactLinkedList::kNullIndex;
+
+  for (int index = 0; index < list.size_; index++) {
+    if (slot == CompactLinkedList::kNullIndex) return false;
+    if (list.compact_ && slot != static_cast<std::uint32_t>(index)) return false;
+    if (static_cast<Element>(list.data_[slot]) != elements[index]) return false;
+    last = slot;
+    slot = list.next_[slot];
+  }
+  if (slot != CompactLinkedList::kNullIndex || list.tail_ != last) return false;
+
+  // каждый выданный слот занят узлом либо находится в списке свободных слотов
+  int num_free_slots = 0;
+  for (std::uint32_t free = list.free_list_; free != CompactLinkedList::kNullIndex; free = list.next_[free]) {
+    num_free_slots += 1;
+    if (num_free_slots > list.num_slots_used_) return false;
+  }
+  return list.size_ + num_free_slots == list.num_slots_used_;
+}
+
+}  // namespace itis
@@ -0,0 +1,253 @@
+#include "concurrent_array_list.hpp"
+
+#include <algorithm>  // min, max
+#include <climits>    // INT_MAX
+#include <new>        // placement new
+#include <stdexcept>  // out_of_range, invalid_argument, length_error
+#include <utility>    // swap
+
+#include "private/internal.hpp"  // вспомогательные функции
+
+namespace itis {
+
+namespace {
+
+// номер старшего установленного бита (value != 0)
+int highest_bit(unsigned long long value) {
+#if defined(__GNUC__)
+  return 63 - __builtin_clzll(value);
+#else
+  int bit = 0;
+  while (value >>= 1) {
+    bit += 1;
+  }
+  return bit;
+#endif
+}
+
+// номер сегмента и смещение в нем: индекс + kFirstSegmentCapacity = 2^(segment + kFirstSegmentShift) + offset
+struct SegmentPosition {
+  int segment;
+  std::size_t offset;
+};
+
+SegmentPosition locate(long long index) {
+  const auto biased = static_cast<unsigned long long>(index) + ConcurrentArrayList::kFirstSegmentCapacity;
+  const int segment = highest_bit(biased) - ConcurrentArrayList::kFirstSegmentShift;
+  return {segment, static_cast<std::size_t>(biased - (1ull << (segment + ConcurrentArrayList::kFirstSegmentShift)))};
+}
+
+}  // namespace
+
+ConcurrentArrayList::ConcurrentArrayList(std::pmr::memory_resource *resource) : resource_{resource} {
+  if (resource == nullptr) {
+    throw std::invalid_argument("ConcurrentArrayList::resource must not be null");
+  }
+}
+
+ConcurrentArrayList::ConcurrentArrayList(ConcurrentArrayList &&other) noexcept : resource_{other.resource_} {
+  Swap(other);
+}
+
+ConcurrentArrayList &ConcurrentArrayList::operator=(ConcurrentArrayList &&other) noexcept {
+  if (this != &other) {
+    ConcurrentArrayList moved{std::move(other)};
+    Swap(moved);
+  }
+  return *this;
+}
+
+ConcurrentArrayList::~ConcurrentArrayList() {
+  Clear();
+}
+
+void ConcurrentArrayList::Swap(ConcurrentArrayList &other) noexcept {
+  // обмен не атомарен целиком: вызывается только без параллельных производителей и читателей
+  const long long size = size_.load(std::memory_order_relaxed);
+  size_.store(other.size_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  other.size_.store(size, std::memory_order_relaxed);
+
+  for (int segment = 0; segment < kMaxSegments; segment++) {
+    Cell *cells = segments_[segment].load(std::memory_order_relaxed);
+    segments_[segment].store(other.segments_[segment].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    other.segments_[segment].store(cells, std::memory_order_relaxed);
+  }
+  std::swap(resource_, other.resource_);
+}
+
+ConcurrentArrayList ConcurrentArrayList::Clone() const {
+  ConcurrentArrayList clone(resource_);
+
+  const int size = GetSize();
+  for (int index = 0; index < size; index++) {
+    const Element e = load(index);
+    clone.store_range(index, &e, 1);
+  }
+  clone.size_.store(size, std::memory_order_relaxed);
+  return clone;
+}
+
+void ConcurrentArrayList::Add(Element e) {
+  AddRange(&e, 1);
+}
+
+void ConcurrentArrayList::AddRange(const Element *elements, int count) {
+  if (count < 0) {
+    throw std::invalid_argument("ConcurrentArrayList::count must not be negative");
+  }
+  if (count == 0) return;
+
+  // порядок памяти relaxed: резервирование только делит ячейки между потоками,
+  // публикацию значений обеспечивают release-записи в сами ячейки
+  const long long start = size_.fetch_add(count, std::memory_order_relaxed);
+
+  // переполнение - редкий случай: резервирование отменяется после проверки, а не проверяется до нее,
+  // чтобы обычное добавление обходилось одним fetch_add без повторов при конкуренции.
+  // Все резервирования после неудачного тоже выходят за INT_MAX и отменяются, поэтому размер
+  // возвращается к сумме удачных резервирований, а ячейки [start, INT_MAX) никогда не учитываются навсегда
+  if (start > INT_MAX - count) {
+    size_.fetch_sub(count, std::memory_order_relaxed);
+    throw std::length_error("ConcurrentArrayList::size must not exceed INT_MAX");
+  }
+  store_range(start, elements, count);
+}
+
+Element ConcurrentArrayList::Get(int index) const {
+  internal::check_out_of_range(index, 0, GetSize());
+  return load(index);
+}
+
+void ConcurrentArrayList::Clear() {
+  for (int segment = 0; segment < kMaxSegments; segment++) {
+    Cell *cells = segments_[segment].exchange(nullptr, std::memory_order_relaxed);
+    if (cells != nullptr) {
+      // std::atomic<Element> тривиально уничтожаем, достаточно освободить память
+      resource_->deallocate(cells, segment_capacity(segment) * sizeof(Cell), alignof(Cell));
+    }
+  }
+  size_.store(0, std::memory_order_relaxed);
+}
+
+ArrayList ConcurrentArrayList::ToArrayList() const {
+  const int size = GetSize();
+  ArrayList result(std::max(size, ArrayList::kInitCapacity), resource_);
+
+  // ячейки атомарные: копируем их значения в буфер и добавляем диапазонами
+  std::array<Element, 256> buffer{};
+  for (int index = 0; index < size;) {
+    const int count = std::min(size - index, static_cast<int>(buffer.size()));
+    for (int offset = 0; offset < count; offset++) {
+      buffer[offset] = load(index + offset);
+    }
+    result.AddRange(buffer.data(), count);
+    index += count;
+  }
+  return result;
+}
+
+int ConcurrentArrayList::GetSize() const {
+  // размер превышает INT_MAX только между резервированием и отменой неудачного AddRange
+  return static_cast<int>(std::min<long long>(size_.load(std::memory_order_acquire), INT_MAX));
+}
+
+bool ConcurrentArrayList::IsEmpty() const {
+  return GetSize() == 0;
+}
+
+int ConcurrentArrayList::GetCapacity() const {
+  long long capacity = 0;
+  for (int segment = 0; segment < kMaxSegments; segment++) {
+    if (segments_[segment].load(std::memory_order_acquire) != nullptr) {
+      capacity += static_cast<long long>(segment_capacity(segment));
+    }
+  }
+  return static_cast<int>(std::min<long long>(capacity, INT_MAX));
+}
+
+std::pmr::memory_resource *ConcurrentArrayList::GetMemoryResource() const {
+  return resource_;
+}
+
+std::size_t ConcurrentArrayList::segment_capacity(int segment) {
+  return static_cast<std::size_t>(kFirstSegmentCapacity) << segment;
+}
+
+ConcurrentArrayList::Cell *ConcurrentArrayList::ensure_segment(int segment) {
+  Cell *cells = segments_[segment].load(std::memory_order_acquire);
+  if (cells != nullptr) return cells;
+
+  const std::size_t capacity = segment_capacity(segment);
+  void *memory = resource_->allocate(capacity * sizeof(Cell), alignof(Cell));
+
+  auto *new_cells = static_cast<Cell *>(memory);
+  for (std::size_t offset = 0; offset < capacity; offset++) {
+    new (new_cells + offset) Cell(Element::UNINITIALIZED);
+  }
+
+  // release: ячейки, заполненные Element::UNINITIALIZED, видны тому, кто прочитает указатель (acquire)
+  if (segments_[segment].compare_exchange_strong(cells, new_cells, std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+    return new_cells;
+  }
+
+  // сегмент успел установить другой поток (cells - его сегмент)
+  resource_->deallocate(memory, capacity * sizeof(Cell), alignof(Cell));
+  return cells;
+}
+
+void ConcurrentArrayList::store_range(long long start, const Element *elements, int count) {
+  SegmentPosition position = locate(start);
+
+  for (int stored = 0; stored < count;) {
+    Cell *cells = ensure_segment(position.segment);
+
+    const std::size_t capacity = segment_capacity(position.segment);
+    const int num_cells = static_cast<int>(std::min<std::size_t>(capacity - position.offset, count - stored));
+
+    for (int cell = 0; cell < num_cells; cell++) {
+      cells[position.offset + cell].store(elements[stored + cell], std::memory_order_release);
+    }
+
+    stored += num_cells;
+    position = {position.segment + 1, 0};
+  }
+}
+
+Element ConcurrentArrayList::load(int index) const {
+  const SegmentPosition position = locate(index);
+  const Cell *cells = segments_[position.segment].load(std::memory_order_acquire);
+
+  // ячейка зарезервирована, но производитель еще не установил сегмент
+  if (cells == nullptr) return Element::UNINITIALIZED;
+
+  return cells[position.offset].load(std::memory_order_acquire);
+}
+
+// необходимо для тестирования
+
+ConcurrentArrayList::ConcurrentArrayList(const std::vector<Element> &elements) {
+  AddRange(elements.data(), static_cast<int>(elements.size()));
+}
+
+std::ostream &operator<<(std::ostream &os, const ConcurrentArrayList &list) {
+  const int size = list.GetSize();
+  os << "{ ";
+  for (int index = 0; index < size; index++) {
+    os << internal::elem_to_str(list.load(index)) << (index + 1 < size ? ", " : " ");
+  }
+  os << '}';
+  return os;
+}
+
+bool operator==(const ConcurrentArrayList &list, const std::vector<Element> &elements) {
+  if (list.GetSize() != static_cast<int>(elements.size())) return false;
+
+  for (int index = 0; index < list.GetSize(); index++) {
+    if (list.load(index) != elements[index]) return false;
+  }
+
+  // все сегменты, покрывающие зарезервированные ячейки, должны быть выделены
+  return list.IsEmpty() || list.GetCapacity() >= list.GetSize();
+}
+
+}  // namespace itis
@@ -0,0 +1,281 @@
+#include "private/element_search.hpp"
+
+#include <initializer_list>  // initializer_list
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ITIS_SEARCH_X86 1
+#include <immintrin.h>  // SSE2, AVX2, AVX-512 intrinsics
+#else
+#define ITIS_SEARCH_X86 0
+#endif
+
+namespace itis::internal {
+
+namespace {
+
+constexpr int kNotFound = -1;
+
+// === скалярная реализация (эталон) ===
+
+int index_of_scalar(const Element *data, int size, Element e) {
+  for (int index = 0; index < size; index++) {
+    if (data[index] == e) return index;
+  }
+  return kNotFound;
+}
+
+int last_index_of_scalar(const Element *data, int size, Element e) {
+  for (int index = size - 1; index >= 0; index--) {
+    if (data[index] == e) return index;
+  }
+  return kNotFound;
+}
+
+int count_scalar(const Element *data, int size, Element e) {
+  int result = 0;
+  for (int index = 0; index < size; index++) {
+    result += data[index] == e ? 1 : 0;
+  }
+  return result;
+}
+
+#if ITIS_SEARCH_X86
+
+// индекс младшего / старшего установленного бита маски (mask != 0)
+inline int lowest_bit(unsigned mask) {
+  return __builtin_ctz(mask);
+}
+
+inline int highest_bit(unsigned mask) {
+  return 31 - __builtin_clz(mask);
+}
+
+// === SSE2: 4 элемента за сравнение ===
+
+__attribute__((target("sse2")))
+int index_of_sse2(const Element *data, int size, Element e) {
+  const __m128i needle = _mm_set1_epi32(static_cast<int>(e));
+
+  int index = 0;
+  for (; index + 4 <= size; index += 4) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + index));
+    const auto mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle))));
+    if (mask != 0) return index + lowest_bit(mask);
+  }
+
+  const int tail = index_of_scalar(data + index, size - index, e);
+  return tail == kNotFound ? kNotFound : index + tail;
+}
+
+__attribute__((target("sse2")))
+int last_index_of_sse2(const Element *data, int size, Element e) {
+  const __m128i needle = _mm_set1_epi32(static_cast<int>(e));
+
+  int index = size;
+  for (; index >= 4; index -= 4) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + index - 4));
+    const auto mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle))));
+    if (mask != 0) return index - 4 + highest_bit(mask);
+  }
+  return last_index_of_scalar(data, index, e);
+}
+
+__attribute__((target("sse2")))
+int count_sse2(const Element *data, int size, Element e) {
+  const __m128i needle = _mm_set1_epi32(static_cast<int>(e));
+
+  // результат сравнения: -1 при совпадении, поэтому вычитаем
+  __m128i counters = _mm_setzero_si128();
+
+  int index = 0;
+  for (; index + 4 <= size; index += 4) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + index));
+    counters = _mm_sub_epi32(counters, _mm_cmpeq_epi32(block, needle));
+  }
+
+  alignas(16) int lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), counters);
+
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3] + count_scalar(data + index, size - index, e);
+}
+
+// === AVX2: 8 элементов за сравнение ===
+
+__attribute__((target("avx2")))
+int index_of_avx2(const Element *data, int size, Element e) {
+  const __m256i needle = _mm256_set1_epi32(static_cast<int>(e));
+
+  int index = 0;
+  for (; index + 8 <= size; index += 8) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index));
+    const auto mask =
+        static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle))));
+    if (mask != 0) return index + lowest_bit(mask);
+  }
+
+  const int tail = index_of_scalar(data + index, size - index, e);
+  return tail == kNotFound ? kNotFound : index + tail;
+}
+
+__attribute__((target("avx2")))
+int last_index_of_avx2(const Element *data, int size, Element e) {
+  const __m256i needle = _mm256_set1_epi32(static_cast<int>(e));
+
+  int index = size;
+  for (; index >= 8; index -= 8) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index - 8));
+    const auto mask =
+        static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle))));
+    if (mask != 0) return index - 8 + highest_bit(mask);
+  }
+  return last_index_of_scalar(data, index, e);
+}
+
+__attribute__((target("avx2")))
+int count_avx2(const Element *data, int size, Element e) {
+  const __m256i needle = _mm256_set1_epi32(static_cast<int>(e));
+  __m256i counters = _mm256_setzero_si256();
+
+  int index = 0;
+  for (; index + 8 <= size; index += 8) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index));
+    counters = _mm256_sub_epi32(counters, _mm256_cmpeq_epi32(block, needle));
+  }
+
+  alignas(32) int lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), counters);
+
+  int result = count_scalar(data + index, size - index, e);
+  for (const int lane : lanes) {
+    result += lane;
+  }
+  return result;
+}
+
+// === AVX-512: 16 элементов за сравнение ===
+
+__attribute__((target("avx512f")))
+int index_of_avx512(const Element *data, int size, Element e) {
+  const __m512i needle = _mm512_set1_epi32(static_cast<int>(e));
+
+  int index = 0;
+  for (; index + 16 <= size; index += 16) {
+    const __m512i block = _mm512_loadu_si512(data + index);
+    const unsigned mask = _mm512_cmpeq_epi32_mask(block, needle);
+    if (mask != 0) return index + lowest_bit(mask);
+  }
+
+  const int tail = index_of_scalar(data + index, size - index, e);
+  return tail == kNotFound ? kNotFound : index + tail;
+}
+
+__attribute__((target("avx512f")))
+int last_index_of_avx512(const Element *data, int size, Element e) {
+  const __m512i needle = _mm512_set1_epi32(static_cast<int>(e));
+
+  int index = size;
+  for (; index >= 16; index -= 16) {
+    const __m512i block = _mm512_loadu_si512(data + index - 16);
+    const unsigned mask = _mm512_cmpeq_epi32_mask(block, needle);
+    if (mask != 0) return index - 16 + highest_bit(mask);
+  }
+  return last_index_of_scalar(data, index, e);
+}
+
+__attribute__((target("avx512f")))
+int count_avx512(const Element *data, int size, Element e) {
+  const __m512i needle = _mm512_set1_epi32(static_cast<int>(e));
+
+  int result = 0;
+  int index = 0;
+  for (; index + 16 <= size; index += 16) {
+    const __m512i block = _mm512_loadu_si512(data + index);
+    result += __builtin_popcount(_mm512_cmpeq_epi32_mask(block, needle));
+  }
+  return result + count_scalar(data + index, size - index, e);
+}
+
+#endif  // ITIS_SEARCH_X86
+
+// таблица функций одной реализации
+struct Kernels {
+  int (*index_of)(const Element *, int, Element);
+  int (*last_index_of)(const Element *, int, Element);
+  int (*count)(const Element *, int, Element);
+};
+
+const Kernels &kernels_of(SearchKernel kernel) {
+  static constexpr Kernels kScalar{index_of_scalar, last_index_of_scalar, count_scalar};
+#if ITIS_SEARCH_X86
+  static constexpr Kernels kSse2{index_of_sse2, last_index_of_sse2, count_sse2};
+  static constexpr Kernels kAvx2{index_of_avx2, last_index_of_avx2, count_avx2};
+  static constexpr Kernels kAvx512{index_of_avx512, last_index_of_avx512, count_avx512};
+
+  switch (kernel) {
+    case SearchKernel::SSE2:return kSse2;
+    case SearchKernel::AVX2:return kAvx2;
+    case SearchKernel::AVX512:return kAvx512;
+    default:return kScalar;
+  }
+#else
+  return kScalar;
+#endif
+}
+
+// реализация по умолчанию (выбирается один раз)
+const Kernels &best_kernels() {
+  static const Kernels &kernels = kernels_of(best_search_kernel());
+  return kernels;
+}
+
+}  // namespace
+
+bool is_supported(SearchKernel kernel) {
+#if ITIS_SEARCH_X86
+  switch (kernel) {
+    case SearchKernel::SCALAR:return true;
+    case SearchKernel::SSE2:return __builtin_cpu_supports("sse2");
+    case SearchKernel::AVX2:return __builtin_cpu_supports("avx2");
+    case SearchKernel::AVX512:return __builtin_cpu_supports("avx512f");
+  }
+  return false;
+#else
+  return kernel == SearchKernel::SCALAR;
+#endif
+}
+
+SearchKernel best_search_kernel() {
+  static const SearchKernel best = [] {
+    for (const auto kernel : {SearchKernel::AVX512, SearchKernel::AVX2, SearchKernel::SSE2}) {
+      if (is_supported(kernel)) return kernel;
+    }
+    return SearchKernel::SCALAR;
+  }();
+  return best;
+}
+
+int index_of(const Element *data, int size, Element e) {
+  return best_kernels().index_of(data, size, e);
+}
+
+int last_index_of(const Element *data, int size, Element e) {
+  return best_kernels().last_index_of(data, size, e);
+}
+
+int count(const Element *data, int size, Element e) {
+  return best_kernels().count(data, size, e);
+}
+
+int index_of(const Element *data, int size, Element e, SearchKernel kernel) {
+  return kernels_of(kernel).index_of(data, size, e);
+}
+
+int last_index_of(const Element *data, int size, Element e, SearchKernel kernel) {
+  return kernels_of(kernel).last_index_of(data, size, e);
+}
+
+int count(const Element *data, int size, Element e, SearchKernel kernel) {
+  return kernels_of(kernel).count(data, size, e);
+}
+
+}  // namespace itis::internal
@@ -0,0 +1,82 @@
+#include "growth_policy.hpp"
+
+#include <cassert>    // assert
+#include <limits>     // numeric_limits
+#include <stdexcept>  // invalid_argument, length_error
+
+namespace itis {
+
+GrowthPolicy GrowthPolicy::Additive(int increment) {
+  if (increment <= 0) {
+    throw std::invalid_argument("GrowthPolicy::increment must be positive");
+  }
+  GrowthPolicy policy;
+  policy.kind_ = Kind::ADDITIVE;
+  policy.increment_ = increment;
+  return policy;
+}
+
+GrowthPolicy GrowthPolicy::Geometric(double factor) {
+  if (!(factor > 1.0)) {
+    throw std::invalid_argument("GrowthPolicy::factor must be greater than 1");
+  }
+  GrowthPolicy policy;
+  policy.kind_ = Kind::GEOMETRIC;
+  policy.factor_ = factor;
+  return policy;
+}
+
+GrowthPolicy GrowthPolicy::Custom(Function function) {
+  if (function == nullptr) {
+    throw std::invalid_argument("GrowthPolicy::function must not be null");
+  }
+  GrowthPolicy policy;
+  policy.kind_ = Kind::CUSTOM;
+  policy.function_ = function;
+  return policy;
+}
+
+int GrowthPolicy::NextCapacity(int capacity, int min_capacity) const {
+  if (min_capacity < 0) {
+    // переполнение int при вычислении необходимой емкости на стороне вызывающего
+    throw std::length_error("GrowthPolicy::capacity exceeds the maximum size");
+  }
+  assert(capacity >= 0 && min_capacity > capacity);
+
+  constexpr long long kMaxCapacity = std::numeric_limits<int>::max();
+
+  // считаем в 64-битных числах, чтобы не словить переполнение на больших емкостях
+  long long next = 0;
+
+  switch (kind_) {
+    case Kind::ADDITIVE:next = static_cast<long long>(capacity) + increment_;
+      break;
+    case Kind::GEOMETRIC: {
+      const double scaled = static_cast<double>(capacity) * factor_;
+      next = scaled < static_cast<double>(kMaxCapacity) ? static_cast<long long>(scaled) : kMaxCapacity;
+      break;
+    }
+    case Kind::CUSTOM:next = function_(capacity, min_capacity);
+      break;
+  }
+
+  if (next < min_capacity) next = min_capacity;
+
+  if (next > kMaxCapacity) next = kMaxCapacity;  // упираемся в предел int, min_capacity все еще помещается
+
+  return static_cast<int>(next);
+}
+
+bool GrowthPolicy::IsAdditive() const {
+  return kind_ == Kind::ADDITIVE;
+}
+
+bool GrowthPolicy::IsGeometric() const {
+  return kind_ == Kind::GEOMETRIC;
+}
+
+bool GrowthPolicy::IsCustom() const {
+  return kind_ == Kind::CUSTOM;
+}
+
+}  // namespace itis
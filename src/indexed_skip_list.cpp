@@ -0,0 +1,362 @@
+#include "indexed_skip_list.hpp"
+
+#include <algorithm>  // max
+#include <cassert>    // assert
+#include <new>        // placement new
+#include <stdexcept>  // out_of_range, invalid_argument
+#include <utility>    // swap
+
+#include "private/internal.hpp"  // вспомогательные функции
+
+namespace itis {
+
+namespace {
+
+constexpr std::size_t kNodeAlignment = std::max(alignof(SkipNode), alignof(SkipLink));
+
+// размер памяти под узел с level связями
+std::size_t node_size(int level) {
+  return sizeof(SkipNode) + sizeof(SkipLink) * static_cast<std::size_t>(level);
+}
+
+}  // namespace
+
+IndexedSkipList::IndexedSkipList(std::uint64_t seed, std::pmr::memory_resource *resource)
+    : random_state_{seed != 0 ? seed : kDefaultSeed}, resource_{resource} {
+  if (resource == nullptr) {
+    throw std::invalid_argument("IndexedSkipList::resource must not be null");
+  }
+}
+
+IndexedSkipList::IndexedSkipList(IndexedSkipList &&other) noexcept
+    : size_{other.size_},
+      level_{other.level_},
+      head_{other.head_},
+      random_state_{other.random_state_},
+      resource_{other.resource_} {
+  other.size_ = 0;
+  other.level_ = 1;
+  other.head_ = nullptr;
+}
+
+IndexedSkipList &IndexedSkipList::operator=(IndexedSkipList &&other) noexcept {
+  if (this != &other) {
+    IndexedSkipList moved{std::move(other)};
+    Swap(moved);
+  }
+  return *this;
+}
+
+IndexedSkipList::~IndexedSkipList() {
+  Clear();
+  if (head_ != nullptr) {
+    destroy_node(head_);
+    head_ = nullptr;
+  }
+}
+
+void IndexedSkipList::Swap(IndexedSkipList &other) noexcept {
+  std::swap(size_, other.size_);
+  std::swap(level_, other.level_);
+  std::swap(head_, other.head_);
+  std::swap(random_state_, other.random_state_);
+  std::swap(resource_, other.resource_);
+}
+
+IndexedSkipList IndexedSkipList::Clone() const {
+  IndexedSkipList clone(random_state_, resource_);
+  if (head_ != nullptr) {
+    for (const SkipNode *node = head_->links()[0].next; node != nullptr; node = node->links()[0].next) {
+      clone.Add(node->data);
+    }
+  }
+  return clone;
+}
+
+void IndexedSkipList::Add(Element e) {
+  Insert(size_, e);
+}
+
+void IndexedSkipList::Insert(int index, Element e) {
+  internal::check_out_of_range(index, 0, size_ + 1);
+
+  if (head_ == nullptr) {
+    head_ = create_node(Element::UNINITIALIZED, kMaxLevel);
+  }
+
+  SkipNode *update[kMaxLevel];
+  int rank[kMaxLevel];
+  find_predecessors(index, update, rank);
+
+  const int level = random_level();
+
+  // новые уровни: предшественник - заголовок, связь ведет в конец списка
+  for (int lvl = level_; lvl < level; lvl++) {
+    update[lvl] = head_;
+    rank[lvl] = 0;
+    head_->links()[lvl] = SkipLink{nullptr, size_ + 1};
+  }
+  level_ = std::max(level_, level);
+
+  SkipNode *node = create_node(e, level);
+
+  // 1. уровни нового узла: связь предшественника делится новым узлом на две
+  for (int lvl = 0; lvl < level; lvl++) {
+    SkipLink &prev = update[lvl]->links()[lvl];
+    const int distance = index - rank[lvl];  // расстояние от предшественника до позиции вставки
+
+    node->links()[lvl] = SkipLink{prev.next, prev.width - distance};
+    prev = SkipLink{node, distance + 1};
+  }
+
+  // 2. более высокие уровни: связь предшественника "перешагивает" новый узел
+  for (int lvl = level; lvl < level_; lvl++) {
+    update[lvl]->links()[lvl].width += 1;
+  }
+
+  size_ += 1;
+}
+
+void IndexedSkipList::Set(int index, Element e) {
+  internal::check_out_of_range(index, 0, size_);
+  find_node(index)->data = e;
+}
+
+Element IndexedSkipList::Remove(int index) {
+  internal::check_out_of_range(index, 0, size_);
+
+  SkipNode *update[kMaxLevel];
+  int rank[kMaxLevel];
+  find_predecessors(index, update, rank);
+
+  SkipNode *node = update[0]->links()[0].next;
+
+  for (int lvl = 0; lvl < level_; lvl++) {
+    SkipLink &prev = update[lvl]->links()[lvl];
+
+    if (prev.next == node) {
+      // связь предшественника "склеивается" со связью удаляемого узла
+      prev.width += node->links()[lvl].width - 1;
+      prev.next = node->links()[lvl].next;
+    } else {
+      prev.width -= 1;
+    }
+  }
+
+  // опустевшие верхние уровни больше не используются
+  while (level_ > 1 && head_->links()[level_ - 1].next == nullptr) {
+    level_ -= 1;
+  }
+
+  const Element result = node->data;
+  destroy_node(node);
+  size_ -= 1;
+  return result;
+}
+
+void IndexedSkipList::Clear() {
+  if (head_ == nullptr) return;
+
+  // монотонный источник памяти освобождает память только целиком, обходить узлы незачем
+  if (!internal::releases_memory_in_bulk(resource_)) {
+    SkipNode *node = head_->links()[0].next;
+    while (node != nullptr) {
+      SkipNode *next = node->links()[0].next;
+      destroy_node(node);
+      node = next;
+    }
+  }
+
+  for (int lvl = 0; lvl < level_; lvl++) {
+    head_->links()[lvl] = SkipLink{};
+  }
+  level_ = 1;
+  size_ = 0;
+}
+
+Element IndexedSkipList::Get(int index) const {
+  internal::check_out_of_range(index, 0, size_);
+  return find_node(index)->data;
+}
+
+int IndexedSkipList::IndexOf(Element e) const {
+  if (head_ == nullptr) return kNotFoundElementIndex;
+
+  int index = 0;
+  for (const SkipNode *node = head_->links()[0].next; node != nullptr; node = node->links()[0].next, index++) {
+    if (node->data == e) return index;
+  }
+  return kNotFoundElementIndex;
+}
+
+bool IndexedSkipList::Contains(Element e) const {
+  return IndexOf(e) != kNotFoundElementIndex;
+}
+
+int IndexedSkipList::Count(Element e) const {
+  if (head_ == nullptr) return 0;
+
+  int result = 0;
+  for (const SkipNode *node = head_->links()[0].next; node != nullptr; node = node->links()[0].next) {
+    result += node->data == e ? 1 : 0;
+  }
+  return result;
+}
+
+int IndexedSkipList::GetSize() const {
+  return size_;
+}
+
+bool IndexedSkipList::IsEmpty() const {
+  return size_ == 0;
+}
+
+int IndexedSkipList::GetLevel() const {
+  return level_;
+}
+
+Element IndexedSkipList::tail() const {
+  return size_ > 0 ? find_node(size_ - 1)->data : Element::UNINITIALIZED;
+}
+
+Element IndexedSkipList::head() const {
+  return size_ > 0 ? head_->links()[0].next->data : Element::UNINITIALIZED;
+}
+
+std::pmr::memory_resource *IndexedSkipList::GetMemoryResource() const {
+  return resource_;
+}
+
+SkipNode *IndexedSkipList::create_node(Element e, int level) {
+  void *memory = resource_->allocate(node_size(level), kNodeAlignment);
+  auto *node = new(memory) SkipNode(e, level);
+
+  auto *links = reinterpret_cast<SkipLink *>(static_cast<char *>(memory) + sizeof(SkipNode));
+  for (int lvl = 0; lvl < level; lvl++) {
+    new(links + lvl) SkipLink;
+  }
+  return node;
+}
+
+void IndexedSkipList::destroy_node(SkipNode *node) {
+  const int level = node->level;
+  node->~SkipNode();
+  resource_->deallocate(node, node_size(level), kNodeAlignment);
+}
+
+int IndexedSkipList::random_level() {
+  // xorshift64*: достаточно качественный и очень быстрый генератор, состояние - одно 64-битное число
+  random_state_ ^= random_state_ >> 12;
+  random_state_ ^= random_state_ << 25;
+  random_state_ ^= random_state_ >> 27;
+  std::uint64_t bits = (random_state_ * 0x2545F4914F6CDD1Dull) >> 32;  // старшие биты качественнее младших
+
+  // каждый следующий уровень с вероятностью 1/2: кол-во единичных младших битов
+  int level = 1;
+  while ((bits & 1u) != 0 && level < kMaxLevel) {
+    level += 1;
+    bits >>= 1u;
+  }
+  return level;
+}
+
+SkipNode *IndexedSkipList::find_node(int index) const {
+  assert(index >= 0 && index < size_);
+
+  const int position = index + 1;  // позиции элементов начинаются с 1 (позиция заголовка - 0)
+
+  SkipNode *node = head_;
+  int pos = 0;
+
+  // спуск сверху вниз: на каждом уровне идем вперед, пока не "перешагнем" искомую позицию
+  for (int lvl = level_ - 1; lvl >= 0; lvl--) {
+    const SkipLink *link = &node->links()[lvl];
+    while (link->next != nullptr && pos + link->width <= position) {
+      pos += link->width;
+      node = link->next;
+      link = &node->links()[lvl];
+    }
+    if (pos == position) break;
+  }
+
+  assert(pos == position);
+  return node;
+}
+
+void IndexedSkipList::find_predecessors(int index, SkipNode **update, int *rank) const {
+  assert(index >= 0 && index <= size_);
+
+  SkipNode *node = head_;
+  int pos = 0;
+
+  for (int lvl = level_ - 1; lvl >= 0; lvl--) {
+    const SkipLink *link = &node->links()[lvl];
+    while (link->next != nullptr && pos + link->width <= index) {
+      pos += link->width;
+      node = link->next;
+      link = &node->links()[lvl];
+    }
+    update[lvl] = node;
+    rank[lvl] = pos;
+  }
+}
+
+// === необходимо для тестирования ===
+
+IndexedSkipList::IndexedSkipList(const std::vector<Element> &elements) {
+  for (const auto e : elements) {
+    Add(e);
+  }
+}
+
+std::ostream &operator<<(std::ostream &os, const IndexedSkipList &list) {
+  if (list.size_ > 0) {
+    os << "{ ";
+    for (const SkipNode *node = list.head_->links()[0].next; node != nullptr; node = node->links()[0].next) {
+      os << internal::elem_to_str(node->data) << (node->links()[0].next == nullptr ? " }" : ", ");
+    }
+  } else {
+    os << "{ nullptr }";
+  }
+  return os;
+}
+
+bool operator==(const IndexedSkipList &list, const std::vector<Element> &elements) {
+  if (list.size_ != static_cast<int>(elements.size())) return false;
+  if (list.head_ == nullptr) return list.size_ == 0;
+
+  // 1. нижний уровень совпадает с вектором
+  auto it = elements.begin();
+  for (const SkipNode *node = list.head_->links()[0].next; node != nullptr; node = node->links()[0].next, ++it) {
+    if (it == elements.end() || node->data != *it) return false;
+  }
+  if (it != elements.end()) return false;
+
+  // 2. ширина каждой связи равна кол-ву шагов по нижнему уровню до следующего узла
+  for (int lvl = 0; lvl < list.level_; lvl++) {
+    const SkipNode *node = list.head_;
+    const SkipNode *bottom = list.head_;
+
+    while (node->links()[lvl].next != nullptr) {
+      const SkipNode *next = node->links()[lvl].next;
+      if (next->level <= lvl) return false;
+
+      int steps = 0;
+      while (bottom != next) {
+        bottom = bottom->links()[0].next;
+        if (bottom == nullptr) return false;
+        steps += 1;
+      }
+      if (steps != node->links()[lvl].width) return false;
+      node = next;
+    }
+  }
+
+  // 3. уровни выше используемых пусты
+  for (int lvl = list.level_; lvl < IndexedSkipList::kMaxLevel; lvl++) {
+    if (list.head_->links()[lvl].next != nullptr) return false;
+  }
+  return list.level_ == 1 || list.head_->links()[list.level_ - 1].next != nullptr;
+}
+
+}  // namespace itis
@@ -1,29 +1,85 @@
 #include "linked_list.hpp"
 
+#include <array>      // array
+#include <atomic>     // memory_order
 #include <cassert>    // assert
-#include <stdexcept>  // out_of_range
+#include <cstdlib>    // abs
+#include <new>        // placement new
+#include <stdexcept>  // out_of_range, invalid_argument
+#include <utility>    // swap
 
 #include "private/internal.hpp"  // это не тот приват, о котором вы могли подумать
 
 namespace itis {
 
+LinkedList::LinkedList(std::pmr::memory_resource *resource) : resource_{resource} {
+  if (resource == nullptr) {
+    throw std::invalid_argument("LinkedList::resource must not be null");
+  }
+}
+
+LinkedList::LinkedList(NodeAllocation allocation, std::pmr::memory_resource *resource) : LinkedList(resource) {
+  if (allocation == NodeAllocation::POOL) {
+    pool_ = internal::NodePool(sizeof(Node), alignof(Node), kNodesPerSlab);
+  }
+}
+
+LinkedList::LinkedList(LinkedList &&other) noexcept
+    : size_{other.size_},
+      head_{other.head_},
+      tail_{other.tail_},
+      resource_{other.resource_},
+      counts_{other.counts_},
+      pool_{other.pool_} {
+  set_finger(other.load_finger());
+
+  other.counts_.on_clear();
+  other.pool_.reset();  // слабы перешли к этому списку
+  other.size_ = 0;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.set_finger({});
+}
+
+LinkedList &LinkedList::operator=(LinkedList &&other) noexcept {
+  if (this != &other) {
+    LinkedList moved{std::move(other)};
+    Swap(moved);
+  }
+  return *this;
+}
+
+void LinkedList::Swap(LinkedList &other) noexcept {
+  std::swap(size_, other.size_);
+  std::swap(head_, other.head_);
+  std::swap(tail_, other.tail_);
+
+  const Finger finger = load_finger();
+  set_finger(other.load_finger());
+  other.set_finger(finger);
+
+  std::swap(resource_, other.resource_);
+  std::swap(counts_, other.counts_);
+  std::swap(pool_, other.pool_);
+}
+
+LinkedList LinkedList::Clone() const {
+  LinkedList clone(resource_);
+  clone.pool_ = pool_.empty_copy();
+  if (counts_.enabled()) clone.counts_.enable();
+
+  for (Node *current_node = head_; current_node != nullptr; current_node = current_node->next) {
+    clone.Add(current_node->data);
+  }
+  return clone;
+}
+
 void LinkedList::Add(Element e) {
   // Tip 1: создайте узел в куче со переданным значением
   // Tip 2: есть 2 случая - список пустой и непустой
   // Tip 3: не забудьте обновить поля head и tail
   // напишите свой код здесь ...
-
-  Node *node = new Node(e, nullptr);
-
-  if(size_ == 0) {
-      head_ = node;
-      tail_ = node;
-  }
-  else{
-      tail_->next = node;
-      tail_ = tail_->next;
-  }
-  size_ += 1;
+  insert_after(tail_, e);
 }
 
 void LinkedList::Insert(int index, Element e) {
@@ -37,24 +93,171 @@ void LinkedList::Insert(int index, Element e) {
   //        (4) все остальное
 
   // напишите свой код здесь ...
-  if(index == size_ || size_ == 0) Add(e);
-  else{
-      Node * node = new Node(e, nullptr);
-      size_ += 1;
-      if(index == 0) {
-          node->next = head_;
-          head_ = node;
+  if(index == size_) Add(e);
+  else insert_after(find_node(index)->prev, e);  // новый узел встает перед узлом на позиции вставки
+}
+
+void LinkedList::Splice(LinkedList &&other) {
+  SpliceAt(size_, std::move(other));
+}
+
+void LinkedList::SpliceAt(int index, LinkedList &&other) {
+  internal::check_out_of_range(index, 0, size_ + 1);
+
+  if (&other == this) {
+    throw std::invalid_argument("LinkedList::other must not be the same list");
+  }
+
+  if (other.IsEmpty()) return;
+
+  Node *prev = index == 0 ? nullptr : find_node(index - 1);
+
+  if (!can_adopt_nodes(other)) {
+    // узлы other нельзя освободить через этот список: копируем элементы
+    for (Node *current_node = other.head_; current_node != nullptr; current_node = current_node->next) {
+      insert_after(prev, current_node->data);
+      prev = prev != nullptr ? prev->next : head_;
+    }
+    other.Clear();
+    return;
+  }
+
+  // 1. встраиваем цепочку other между prev и next
+  Node *next = prev != nullptr ? prev->next : head_;
+
+  other.head_->prev = prev;
+  if (prev == nullptr) head_ = other.head_;
+  else prev->next = other.head_;
+
+  other.tail_->next = next;
+  if (next == nullptr) tail_ = other.tail_;
+  else next->prev = other.tail_;
+
+  const Finger finger = load_finger();
+  if (finger.node != nullptr && finger.index >= index) set_finger({finger.node, finger.index + other.size_});
+
+  // 2. узлы other теперь принадлежат этому списку
+  if (pool_.enabled()) pool_.merge(other.pool_);
+
+  if (counts_.enabled()) {
+    if (other.counts_.enabled()) {
+      counts_.on_add_all(other.counts_);
+    } else {
+      for (Node *current_node = other.head_; current_node != next; current_node = current_node->next) {
+        counts_.on_add(current_node->data);
+      }
+    }
+  }
+
+  size_ += other.size_;
+
+  other.size_ = 0;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.set_finger({});
+  other.counts_.on_clear();
+}
+
+LinkedList LinkedList::SplitAt(int index) {
+  internal::check_out_of_range(index, 0, size_ + 1);
+
+  LinkedList suffix(resource_);
+  suffix.pool_ = pool_.empty_copy();
+  if (counts_.enabled()) suffix.counts_.enable();
+
+  if (index == size_) return suffix;
+
+  Node *node = find_node(index);
+
+  if (pool_.enabled()) {
+    // узлы принадлежат слабам этого списка: копируем суффикс и удаляем его с конца
+    for (Node *current_node = node; current_node != nullptr; current_node = current_node->next) {
+      suffix.Add(current_node->data);
+    }
+    while (size_ > index) unlink_node(tail_);
+    return suffix;
+  }
+
+  // 1. счетчики: подсчитываем меньшую из частей, вторую получаем вычитанием
+  if (counts_.enabled()) {
+    internal::ElementCounts part;
+    part.enable();
+
+    if (size_ - index <= index) {
+      for (Node *current_node = node; current_node != nullptr; current_node = current_node->next) {
+        part.on_add(current_node->data);
       }
-      else{
-          Node *curr;
-          curr = head_;
-          for(int i = 0; i < index - 1 ; i++){
-              curr = curr->next;
-          }
-          node->next = curr->next;
-          curr->next = node;
+      suffix.counts_.on_add_all(part);
+      counts_.on_remove_all(part);
+    } else {
+      for (Node *current_node = head_; current_node != node; current_node = current_node->next) {
+        part.on_add(current_node->data);
       }
+      suffix.counts_ = counts_;
+      suffix.counts_.on_remove_all(part);
+      counts_ = part;
+    }
+  }
+
+  // 2. разрываем цепочку перед узлом node
+  Node *prev = node->prev;
+
+  suffix.head_ = node;
+  suffix.tail_ = tail_;
+  suffix.size_ = size_ - index;
+  node->prev = nullptr;
+
+  if (prev == nullptr) head_ = nullptr;
+  else prev->next = nullptr;
+  tail_ = prev;
+  size_ = index;
+
+  // 3. палец (find_node установил его на node) остается в обоих списках рядом с местом разреза
+  suffix.set_finger({node, 0});
+  set_finger({prev, index - 1});
+
+  return suffix;
+}
+
+void LinkedList::Sort() {
+  StableSort();
+}
+
+void LinkedList::StableSort() {
+  std::array<Node *, kNumElementValues> bucket_heads{};
+  std::array<Node *, kNumElementValues> bucket_tails{};
+
+  // 1. раскладываем узлы по цепочкам значений (обратные связи внутри цепочек восстанавливаются сразу)
+  for (Node *current_node = head_; current_node != nullptr;) {
+    Node *next = current_node->next;
+    const int value = static_cast<int>(current_node->data);
+
+    if (bucket_tails[value] == nullptr) {
+      bucket_heads[value] = current_node;
+    } else {
+      bucket_tails[value]->next = current_node;
+      current_node->prev = bucket_tails[value];
+    }
+    bucket_tails[value] = current_node;
+    current_node = next;
+  }
+
+  // 2. соединяем цепочки в порядке возрастания значений
+  head_ = nullptr;
+  tail_ = nullptr;
+  for (int value = 0; value < kNumElementValues; value++) {
+    if (bucket_heads[value] == nullptr) continue;
+
+    if (tail_ == nullptr) head_ = bucket_heads[value];
+    else tail_->next = bucket_heads[value];
+
+    bucket_heads[value]->prev = tail_;
+    tail_ = bucket_tails[value];
   }
+  if (tail_ != nullptr) tail_->next = nullptr;
+
+  // индекс узла под пальцем изменился
+  set_finger({});
 }
 
 void LinkedList::Set(int index, Element e) {
@@ -63,53 +266,35 @@ void LinkedList::Set(int index, Element e) {
   // напишите свой код здесь ...
   Node *node;
   node = find_node(index);
+  counts_.on_set(node->data, e);
   node->data = e;
 }
 
 Element LinkedList::Remove(int index) {
   internal::check_out_of_range(index, 0, size_);
   // Tip 1: рассмотрите случай, когда удаляется элемент в начале списка
-  if(index == 0) {
-      Element result;
-      result = head_->data;
-      head_ = head_->next;
-      size_ -= 1;
-      return result;
-  }
-  if(index == size_ - 1){
-      Node *node = find_node(index - 1);
-      node->next = nullptr;
-      Element result = tail_->data;
-      tail_ = node;
-      size_ -= 1;
-      return result;
-  }
   // Tip 2: используйте функцию find_node(index)
-  Node *node = find_node(index - 1);
-  Node *remove_node = node->next;
-  Element result = remove_node->data;
-  *remove_node = *remove_node->next;
-  node->next = remove_node;
-  size_ -= 1;
   // напишите свой код здесь ...
-  return result;
+  return unlink_node(find_node(index));
 }
 
 void LinkedList::Clear() {
   // Tip 1: люди в черном (MIB) пришли стереть вам память
   // напишите свой код здесь ...
-  if(size_ != 0) {
-      Node *curr = head_;
-      Node *time = curr->next;
-      while (curr->next != nullptr) {
-          delete curr;
-          curr = time;
-          time = curr->next;
-      }
+  // пул и монотонный источник памяти освобождают память только целиком, обходить узлы незачем
+  if (pool_.enabled()) {
+      pool_.release(resource_);
+      internal::count_operation(internal::Operation::NODE_FREED, size_);
+  } else if (!internal::releases_memory_in_bulk(resource_)) {
+      visit_nodes([this](int, Node *node) { destroy_node(node); });
+  } else {
+      internal::count_operation(internal::Operation::NODE_FREED, size_);
   }
   head_ = nullptr;
   tail_ = nullptr;
+  set_finger({});
   size_ = 0;
+  counts_.on_clear();
 }
 
 Element LinkedList::Get(int index) const {
@@ -120,28 +305,151 @@ Element LinkedList::Get(int index) const {
 }
 
 int LinkedList::IndexOf(Element e) const {
-    Node *curr = head_;
-    for(int i = 0; i < size_; i ++){
-        if(curr->data == e){
-            return i;
+    if (counts_.enabled() && counts_.count(e) == 0) return kNotFoundElementIndex;
+
+    // поиск с двух концов одновременно (см. visit_nodes): вхождение, найденное с начала, - первое,
+    // с конца запоминается самое левое из найденных, пока цепочки не встретятся
+    Node *front_node = head_;
+    Node *back_node = tail_;
+    int front_index = 0;
+    int back_index = size_ - 1;
+    int found_index = kNotFoundElementIndex;
+
+    while (front_index <= back_index) {
+        if (front_node->data == e) {
+            internal::count_operation(internal::Operation::NODE_TRAVERSED, front_index + size_ - back_index);
+            return front_index;
         }
-        curr = curr->next;
+        if (back_node->data == e) found_index = back_index;
+        front_node = front_node->next;
+        back_node = back_node->prev;
+        front_index++;
+        back_index--;
     }
-    return kNotFoundElementIndex;
+    internal::count_operation(internal::Operation::NODE_TRAVERSED, size_);
+    return found_index;
 }
 
 Node *LinkedList::find_node(int index) const {
+  const Finger finger = load_finger();
+  Node *node = walk_to(index, finger);
+
+  if (node != finger.node) publish_finger({node, index});
+  return node;
+}
+
+Node *LinkedList::find_node(int index) {
+  Node *node = walk_to(index, load_finger());
+  set_finger({node, index});
+  return node;
+}
+
+Node *LinkedList::walk_to(int index, Finger finger) const {
   assert(index >= 0 && index < size_);
   // Tip 1: можете сразу обработать случаи поиска начала и конца списка
   // напишите свой код здесь ...
-  if(index == 0) return head_;
-  if(index == size_ - 1) return tail_;
-  int counter = 0;
-  for(Node* current_node = head_; current_node != nullptr; current_node = current_node->next){
-      if(counter == index) return current_node;
-      counter += 1;
+  // идем с ближайшей точки: с головы вперед, с хвоста назад или от пальца в нужную сторону
+  Node *current_node = head_;
+  int current_index = 0;
+  int distance = index;
+
+  if (size_ - 1 - index < distance) {
+    current_node = tail_;
+    current_index = size_ - 1;
+    distance = size_ - 1 - index;
+  }
+  if (finger.node != nullptr && std::abs(index - finger.index) < distance) {
+    current_node = finger.node;
+    current_index = finger.index;
+  }
+
+  internal::count_operation(internal::Operation::NODE_TRAVERSED, std::abs(index - current_index));
+  for (; current_index < index; current_index++) current_node = current_node->next;
+  for (; current_index > index; current_index--) current_node = current_node->prev;
+  return current_node;
+}
+
+LinkedList::Finger LinkedList::load_finger() const {
+  const unsigned version = finger_version_.load(std::memory_order_acquire);
+  if (version % 2 != 0) return {};
+
+  // acquire: повторное чтение версии не переставляется раньше чтения узла и индекса
+  const Finger finger{finger_node_.load(std::memory_order_acquire), finger_index_.load(std::memory_order_acquire)};
+
+  // версия не изменилась: узел и индекс записаны одним обновлением
+  if (finger_version_.load(std::memory_order_relaxed) != version) return {};
+  return finger;
+}
+
+void LinkedList::publish_finger(Finger finger) const {
+  unsigned version = finger_version_.load(std::memory_order_relaxed);
+  if (version % 2 != 0 || !finger_version_.compare_exchange_strong(version, version + 1, std::memory_order_relaxed)) {
+    return;  // палец обновляет другой поток: его обновление не хуже этого
+  }
+
+  // release: читатель, увидевший новый узел или индекс, увидит и нечетную версию
+  finger_node_.store(finger.node, std::memory_order_release);
+  finger_index_.store(finger.index, std::memory_order_release);
+  finger_version_.store(version + 2, std::memory_order_release);
+}
+
+void LinkedList::set_finger(Finger finger) {
+  finger_node_.store(finger.node, std::memory_order_relaxed);
+  finger_index_.store(finger.index, std::memory_order_relaxed);
+}
+
+void LinkedList::insert_after(Node *node, Element e) {
+  Node *next = node != nullptr ? node->next : head_;
+  Node *new_node = create_node(e, next, node);
+
+  if (node == nullptr) head_ = new_node;
+  else node->next = new_node;
+
+  if (next == nullptr) tail_ = new_node;
+  else next->prev = new_node;
+
+  // вставка в конец и сразу за пальцем не сдвигает палец, вставка в начало и перед пальцем - сдвигает
+  const Finger finger = load_finger();
+  if (finger.node != nullptr && next != nullptr && node != finger.node) {
+    if (node == nullptr || next == finger.node) set_finger({finger.node, finger.index + 1});
+    else set_finger({});
+  }
+
+  size_ += 1;
+  counts_.on_add(e);
+}
+
+bool LinkedList::can_adopt_nodes(const LinkedList &other) const {
+  // узел освобождается через источник памяти или пул: способ выделения и источник памяти должны совпадать
+  return pool_.enabled() == other.pool_.enabled() && resource_->is_equal(*other.resource_);
+}
+
+Element LinkedList::unlink_node(Node *node) {
+  // удаление с конца не сдвигает палец, удаление с начала и перед пальцем - сдвигает
+  const Finger finger = load_finger();
+  if (finger.node == node) {
+    if (node->prev != nullptr) {
+      set_finger({node->prev, finger.index - 1});
+    } else {
+      set_finger({node->next, finger.index});
+    }
+  } else if (finger.node != nullptr && node->next != nullptr) {
+    if (node->prev == nullptr || node->next == finger.node) set_finger({finger.node, finger.index - 1});
+    else set_finger({});
   }
-  return nullptr;
+
+  // соседи узнают друг о друге напрямую, предыдущий узел искать не нужно
+  if (node->prev == nullptr) head_ = node->next;
+  else node->prev->next = node->next;
+
+  if (node->next == nullptr) tail_ = node->prev;
+  else node->next->prev = node->prev;
+
+  const Element result = node->data;
+  destroy_node(node);
+  size_ -= 1;
+  counts_.on_remove(result);
+  return result;
 }
 
 // РЕАЛИЗОВАНО
@@ -151,8 +459,35 @@ LinkedList::~LinkedList() {
 }
 
 bool LinkedList::Contains(Element e) const {
+  if (counts_.enabled()) return counts_.count(e) > 0;
+
   // если индекс не найден, значит и элемента нет
-  return kNotFoundElementIndex == IndexOf(e);
+  return kNotFoundElementIndex != IndexOf(e);
+}
+
+int LinkedList::Count(Element e) const {
+  if (counts_.enabled()) return counts_.count(e);
+
+  int result = 0;
+  visit_nodes([e, &result](int, const Node *node) { result += node->data == e ? 1 : 0; });
+  return result;
+}
+
+void LinkedList::EnableElementCounts() {
+  if (counts_.enabled()) return;
+
+  counts_.enable();
+  for (Node *current_node = head_; current_node != nullptr; current_node = current_node->next) {
+    counts_.on_add(current_node->data);
+  }
+}
+
+void LinkedList::DisableElementCounts() {
+  counts_.disable();
+}
+
+bool LinkedList::HasElementCounts() const {
+  return counts_.enabled();
 }
 
 int LinkedList::GetSize() const {
@@ -172,18 +507,113 @@ Element LinkedList::head() const {
   return head_ ? head_->data : Element::UNINITIALIZED;
 }
 
+LinkedList::Iterator LinkedList::begin() const {
+  return Iterator(head_, this);
+}
+
+LinkedList::Iterator LinkedList::end() const {
+  return Iterator(nullptr, this);
+}
+
+LinkedList::Cursor LinkedList::BeforeBegin() {
+  return Cursor(this, nullptr);
+}
+
+LinkedList::Cursor LinkedList::CursorAt(int index) {
+  internal::check_out_of_range(index, 0, size_);
+  return Cursor(this, find_node(index));
+}
+
+// === курсор ===
+
+bool LinkedList::Cursor::IsValid() const {
+  return node_ != nullptr;
+}
+
+bool LinkedList::Cursor::HasNext() const {
+  return (node_ != nullptr ? node_->next : list_->head_) != nullptr;
+}
+
+void LinkedList::Cursor::Next() {
+  if (!HasNext()) {
+    throw std::out_of_range("LinkedList::Cursor has no next element");
+  }
+  node_ = node_ != nullptr ? node_->next : list_->head_;
+}
+
+Element LinkedList::Cursor::Get() const {
+  if (!IsValid()) {
+    throw std::out_of_range("LinkedList::Cursor does not point to an element");
+  }
+  return node_->data;
+}
+
+Element LinkedList::Cursor::GetNext() const {
+  if (!HasNext()) {
+    throw std::out_of_range("LinkedList::Cursor has no next element");
+  }
+  return (node_ != nullptr ? node_->next : list_->head_)->data;
+}
+
+void LinkedList::Cursor::Set(Element e) {
+  if (!IsValid()) {
+    throw std::out_of_range("LinkedList::Cursor does not point to an element");
+  }
+  list_->counts_.on_set(node_->data, e);
+  node_->data = e;
+}
+
+void LinkedList::Cursor::InsertAfter(Element e) {
+  list_->insert_after(node_, e);
+}
+
+Element LinkedList::Cursor::EraseAfter() {
+  if (!HasNext()) {
+    throw std::out_of_range("LinkedList::Cursor has no next element");
+  }
+  return list_->unlink_node(node_ != nullptr ? node_->next : list_->head_);
+}
+
+std::pmr::memory_resource *LinkedList::GetMemoryResource() const {
+  return resource_;
+}
+
+LinkedList::NodeAllocation LinkedList::GetNodeAllocation() const {
+  return pool_.enabled() ? NodeAllocation::POOL : NodeAllocation::HEAP;
+}
+
+NodePoolStats LinkedList::GetNodePoolStats() const {
+  return pool_.stats();
+}
+
+Node *LinkedList::create_node(Element e, Node *next, Node *prev) {
+  void *memory = pool_.enabled() ? pool_.allocate(resource_) : resource_->allocate(sizeof(Node), alignof(Node));
+  internal::count_operation(internal::Operation::NODE_ALLOCATED);
+  return new(memory) Node(e, next, prev);
+}
+
+void LinkedList::destroy_node(Node *node) {
+  node->~Node();
+  internal::count_operation(internal::Operation::NODE_FREED);
+  if (pool_.enabled()) {
+    pool_.deallocate(node);
+  } else {
+    resource_->deallocate(node, sizeof(Node), alignof(Node));
+  }
+}
+
 // === RESTRICTED AREA: необходимо для тестирования ===
 
 LinkedList::LinkedList(const std::vector<Element> &elements) {
   assert(!elements.empty());
 
   size_ = elements.size();
-  head_ = new Node(elements[0], nullptr);
+  head_ = create_node(elements[0], nullptr);
 
   auto current_node = head_;
 
   for (int index = 1; index < static_cast<int>(elements.size()); index++) {
-    current_node->next = new Node(elements[index], nullptr);
+    current_node->next = create_node(elements[index], nullptr, current_node);
     current_node = current_node->next;
   }
   tail_ = current_node;
@@ -205,12 +635,26 @@ std::ostream &operator<<(std::ostream &os, const LinkedList &list) {
 bool operator==(const LinkedList &list, const std::vector<Element> &elements) {
   if (list.size_ != static_cast<int>(elements.size())) return false;
   Node *current_node = list.head_;
+  Node *prev_node = nullptr;
 
   for (const auto e : elements) {
     if (current_node == nullptr) return false;
     if (current_node->data != e) return false;
+    if (current_node->prev != prev_node) return false;  // обратные связи должны быть согласованы
+    prev_node = current_node;
     current_node = current_node->next;
   }
+  if (list.tail_ != prev_node) return false;
+
+  // палец должен указывать на узел со своим индексом
+  const LinkedList::Finger finger = list.load_finger();
+  if (finger.node != nullptr) {
+    if (finger.index < 0 || finger.index >= list.size_) return false;
+
+    Node *finger_node = list.head_;
+    for (int index = 0; index < finger.index; index++) finger_node = finger_node->next;
+    if (finger_node != finger.node) return false;
+  }
   return true;
 }
 
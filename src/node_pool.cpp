@@ -0,0 +1,148 @@
+#include "private/node_pool.hpp"
+
+#include <algorithm>  // max
+#include <cassert>    // assert
+#include <new>        // placement new
+#include <stdexcept>  // invalid_argument
+
+namespace itis::internal {
+
+namespace {
+
+// округление вверх до кратного alignment
+std::size_t align_up(std::size_t value, std::size_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+NodePool::NodePool(std::size_t node_size, std::size_t node_alignment, int nodes_per_slab)
+    : nodes_per_slab_{nodes_per_slab} {
+  if (nodes_per_slab <= 0) {
+    throw std::invalid_argument("NodePool::nodes_per_slab must be positive");
+  }
+  // ячейка должна вмещать заголовок свободного узла или диапазона и сохранять выравнивание соседних узлов
+  node_alignment_ = std::max({node_alignment, alignof(FreeNode), alignof(FreeRange)});
+  node_size_ = align_up(std::max({node_size, sizeof(FreeNode), sizeof(FreeRange)}), node_alignment_);
+  nodes_offset_ = align_up(sizeof(Slab), node_alignment_);
+}
+
+void *NodePool::allocate(std::pmr::memory_resource *resource) {
+  assert(enabled());
+
+  num_nodes_in_use_ += 1;
+
+  // 1. повторно используем освобожденный узел
+  if (free_list_ != nullptr) {
+    FreeNode *node = free_list_;
+    free_list_ = node->next;
+    return node;
+  }
+
+  // 2. нарезаем узел из текущего диапазона, затем из диапазонов слияния, затем из нового слаба
+  if (next_unused_ == current_slab_end_) {
+    if (free_ranges_ != nullptr) {
+      FreeRange *range = free_ranges_;
+      free_ranges_ = range->next;
+      next_unused_ = reinterpret_cast<char *>(range);
+      current_slab_end_ = range->end;
+    } else {
+      add_slab(resource);
+    }
+  }
+  void *node = next_unused_;
+  next_unused_ += node_size_;
+  return node;
+}
+
+void NodePool::deallocate(void *node) {
+  assert(enabled() && num_nodes_in_use_ > 0);
+
+  if (free_list_ == nullptr) free_list_tail_ = static_cast<FreeNode *>(node);
+  free_list_ = new(node) FreeNode{free_list_};
+  num_nodes_in_use_ -= 1;
+}
+
+void NodePool::release(std::pmr::memory_resource *resource) {
+  const std::size_t size = slab_size();
+
+  while (slabs_ != nullptr) {
+    Slab *next = slabs_->next;
+    resource->deallocate(slabs_, size, node_alignment_);
+    slabs_ = next;
+  }
+  reset();
+}
+
+void NodePool::reset() {
+  slabs_ = nullptr;
+  last_slab_ = nullptr;
+  free_list_ = nullptr;
+  free_list_tail_ = nullptr;
+  free_ranges_ = nullptr;
+  free_ranges_tail_ = nullptr;
+  next_unused_ = nullptr;
+  current_slab_end_ = nullptr;
+  num_slabs_ = 0;
+  num_nodes_in_use_ = 0;
+}
+
+void NodePool::merge(NodePool &other) {
+  assert(enabled() && node_size_ == other.node_size_ && nodes_per_slab_ == other.nodes_per_slab_);
+
+  // 1. еще не выданные ячейки текущего слаба other становятся диапазоном в начале списка диапазонов other
+  if (other.next_unused_ != other.current_slab_end_) {
+    auto *range = new(other.next_unused_) FreeRange{other.free_ranges_, other.current_slab_end_};
+    if (other.free_ranges_ == nullptr) other.free_ranges_tail_ = range;
+    other.free_ranges_ = range;
+  }
+
+  // 2. списки other встают перед списками этого пула (текущий слаб не меняется)
+  if (other.free_ranges_ != nullptr) {
+    other.free_ranges_tail_->next = free_ranges_;
+    if (free_ranges_ == nullptr) free_ranges_tail_ = other.free_ranges_tail_;
+    free_ranges_ = other.free_ranges_;
+  }
+
+  if (other.free_list_ != nullptr) {
+    other.free_list_tail_->next = free_list_;
+    if (free_list_ == nullptr) free_list_tail_ = other.free_list_tail_;
+    free_list_ = other.free_list_;
+  }
+
+  if (other.slabs_ != nullptr) {
+    other.last_slab_->next = slabs_;
+    if (slabs_ == nullptr) last_slab_ = other.last_slab_;
+    slabs_ = other.slabs_;
+  }
+
+  num_slabs_ += other.num_slabs_;
+  num_nodes_in_use_ += other.num_nodes_in_use_;
+  other.reset();
+}
+
+NodePoolStats NodePool::stats() const {
+  NodePoolStats stats;
+  stats.num_slabs = num_slabs_;
+  stats.num_nodes_in_use = num_nodes_in_use_;
+  stats.num_free_nodes = num_slabs_ * nodes_per_slab_ - num_nodes_in_use_;
+  stats.bytes_reserved = static_cast<long long>(slab_size()) * num_slabs_;
+  return stats;
+}
+
+std::size_t NodePool::slab_size() const {
+  return nodes_offset_ + node_size_ * nodes_per_slab_;
+}
+
+void NodePool::add_slab(std::pmr::memory_resource *resource) {
+  auto *memory = static_cast<char *>(resource->allocate(slab_size(), node_alignment_));
+
+  if (slabs_ == nullptr) last_slab_ = reinterpret_cast<Slab *>(memory);
+  slabs_ = new(memory) Slab{slabs_};
+  num_slabs_ += 1;
+
+  next_unused_ = memory + nodes_offset_;
+  current_slab_end_ = memory + slab_size();
+}
+
+}  // namespace itis::internal
@@ -0,0 +1,42 @@
+#include "operation_stats.hpp"
+
+namespace itis {
+
+#ifdef ADT_ENABLE_STATS
+
+namespace {
+
+long long load(internal::Operation operation) {
+  return internal::operation_counters[static_cast<int>(operation)].load(std::memory_order_relaxed);
+}
+
+}  // namespace
+
+OperationStats Stats() {
+  OperationStats stats;
+  stats.num_resizes = load(internal::Operation::RESIZE);
+  stats.resize_bytes_copied = load(internal::Operation::RESIZE_BYTE_COPIED);
+  stats.num_nodes_allocated = load(internal::Operation::NODE_ALLOCATED);
+  stats.num_nodes_freed = load(internal::Operation::NODE_FREED);
+  stats.num_nodes_traversed = load(internal::Operation::NODE_TRAVERSED);
+  stats.num_out_of_range_errors = load(internal::Operation::OUT_OF_RANGE_ERROR);
+  return stats;
+}
+
+void ResetStats() {
+  for (auto &counter : internal::operation_counters) {
+    counter.store(0, std::memory_order_relaxed);
+  }
+}
+
+#else
+
+OperationStats Stats() {
+  return {};
+}
+
+void ResetStats() {}
+
+#endif
+
+}  // namespace itis
@@ -0,0 +1,344 @@
+#include "packed_array_list.hpp"
+
+#include <algorithm>  // copy, fill, min
+#include <cassert>    // assert
+#include <stdexcept>  // out_of_range, invalid_argument
+#include <utility>    // swap
+
+#include "private/internal.hpp"  // вспомогательные функции
+
+namespace itis {
+
+namespace {
+
+using Word = std::uint64_t;
+
+constexpr int kBits = PackedArrayList::kBitsPerElement;
+constexpr int kPerWord = PackedArrayList::kElementsPerWord;
+
+constexpr Word kElementMask = (Word{1} << kBits) - 1;                  // 0b111
+constexpr Word kWordMask = (Word{1} << (kBits * kPerWord)) - 1;        // используемые 63 бита слова
+constexpr Word kLowBits = kWordMask / kElementMask;                    // 0b001 в каждой ячейке слова
+constexpr int kTopShift = kBits * (kPerWord - 1);                      // смещение последней ячейки слова
+
+// слово, все ячейки которого содержат значение e
+constexpr Word broadcast(Element e) {
+  return kLowBits * static_cast<Word>(e);
+}
+
+constexpr Word kUninitializedWord = broadcast(Element::UNINITIALIZED);
+
+// маска младших bits бит
+constexpr Word low_mask(int bits) {
+  return (Word{1} << bits) - 1;
+}
+
+int num_words(int capacity) {
+  return capacity / kPerWord;
+}
+
+// индекс младшего установленного бита (word != 0)
+int lowest_bit(Word word) {
+#if defined(__GNUC__)
+  return __builtin_ctzll(word);
+#else
+  int bit = 0;
+  while ((word & 1) == 0) {
+    word >>= 1;
+    bit += 1;
+  }
+  return bit;
+#endif
+}
+
+/**
+ * Маска совпадений: в младшем бите каждой ячейки слова 1, если ячейка равна искомому значению.
+ *
+ * @param word - слово с упакованными элементами
+ * @param pattern - искомое значение, размноженное по всем ячейкам (broadcast)
+ */
+Word match_mask(Word word, Word pattern) {
+  const Word diff = word ^ pattern;                              // нулевые ячейки = совпадения
+  const Word non_zero = (diff | (diff >> 1) | (diff >> 2)) & kLowBits;
+  return ~non_zero & kLowBits;
+}
+
+}  // namespace
+
+PackedArrayList::PackedArrayList() : PackedArrayList(kInitCapacity) {}
+
+PackedArrayList::PackedArrayList(int capacity, GrowthPolicy growth_policy, std::pmr::memory_resource *resource)
+    : growth_policy_{growth_policy}, resource_{resource} {
+  if (capacity <= 0) {
+    throw std::invalid_argument("PackedArrayList::capacity must be positive");
+  }
+  if (resource == nullptr) {
+    throw std::invalid_argument("PackedArrayList::resource must not be null");
+  }
+  resize(capacity);
+}
+
+PackedArrayList::PackedArrayList(PackedArrayList &&other) noexcept
+    : size_{other.size_},
+      capacity_{other.capacity_},
+      words_{other.words_},
+      growth_policy_{other.growth_policy_},
+      resource_{other.resource_} {
+  other.size_ = 0;
+  other.capacity_ = 0;
+  other.words_ = nullptr;
+}
+
+PackedArrayList &PackedArrayList::operator=(PackedArrayList &&other) noexcept {
+  if (this != &other) {
+    PackedArrayList moved{std::move(other)};
+    Swap(moved);
+  }
+  return *this;
+}
+
+PackedArrayList::~PackedArrayList() {
+  if (words_ != nullptr) {
+    resource_->deallocate(words_, sizeof(Word) * num_words(capacity_), alignof(Word));
+  }
+  words_ = nullptr;
+  size_ = 0;
+  capacity_ = 0;
+}
+
+void PackedArrayList::Swap(PackedArrayList &other) noexcept {
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(words_, other.words_);
+  std::swap(growth_policy_, other.growth_policy_);
+  std::swap(resource_, other.resource_);
+}
+
+PackedArrayList PackedArrayList::Clone() const {
+  PackedArrayList clone(capacity_ > 0 ? capacity_ : kInitCapacity, growth_policy_, resource_);
+  std::copy(words_, words_ + num_words(capacity_), clone.words_);
+  clone.size_ = size_;
+  return clone;
+}
+
+void PackedArrayList::Add(Element e) {
+  ensure_capacity(size_ + 1);
+  put(size_, e);
+  size_ += 1;
+}
+
+void PackedArrayList::AddRange(const Element *elements, int count) {
+  if (count < 0) {
+    throw std::invalid_argument("PackedArrayList::count must not be negative");
+  }
+  ensure_capacity(size_ + count);
+
+  for (int index = 0; index < count; index++) {
+    put(size_ + index, elements[index]);
+  }
+  size_ += count;
+}
+
+void PackedArrayList::Insert(int index, Element e) {
+  internal::check_out_of_range(index, 0, size_ + 1);
+  ensure_capacity(size_ + 1);
+
+  const int first_word = index / kPerWord;
+  const int last_word = size_ / kPerWord;  // слово, в которое попадет последний элемент
+
+  // 1. слова правее позиции вставки: сдвиг на одну ячейку, последняя ячейка предыдущего слова переходит в первую
+  for (int word = last_word; word > first_word; word--) {
+    words_[word] = ((words_[word] << kBits) | (words_[word - 1] >> kTopShift)) & kWordMask;
+  }
+
+  // 2. слово с позицией вставки: сдвигаются только ячейки, начиная с позиции вставки
+  const int bits = (index % kPerWord) * kBits;
+  const Word word = words_[first_word];
+  words_[first_word] = ((word & low_mask(bits)) | ((word >> bits) << (bits + kBits))) & kWordMask;
+
+  put(index, e);
+  size_ += 1;
+}
+
+void PackedArrayList::Set(int index, Element value) {
+  internal::check_out_of_range(index, 0, size_);
+  put(index, value);
+}
+
+Element PackedArrayList::Remove(int index) {
+  internal::check_out_of_range(index, 0, size_);
+
+  const Element result = take(index);
+
+  const int first_word = index / kPerWord;
+  const int last_word = (size_ - 1) / kPerWord;
+
+  // 1. слово с удаляемым элементом: ячейки правее позиции сдвигаются на одну влево
+  const int bits = (index % kPerWord) * kBits;
+  const Word word = words_[first_word];
+  words_[first_word] = (word & low_mask(bits)) | ((word >> (bits + kBits)) << bits);
+
+  // 2. остальные слова: первая ячейка следующего слова переходит в последнюю ячейку текущего
+  for (int current = first_word; current < last_word; current++) {
+    words_[current] |= (words_[current + 1] & kElementMask) << kTopShift;
+    words_[current + 1] >>= kBits;
+  }
+
+  // 3. освободившиеся ячейки (последняя ячейка слова и последний элемент массива)
+  words_[last_word] |= static_cast<Word>(Element::UNINITIALIZED) << kTopShift;
+  size_ -= 1;
+  put(size_, Element::UNINITIALIZED);
+
+  return result;
+}
+
+void PackedArrayList::Clear() {
+  std::fill(words_, words_ + (size_ + kPerWord - 1) / kPerWord, kUninitializedWord);
+  size_ = 0;
+}
+
+Element PackedArrayList::Get(int index) const {
+  internal::check_out_of_range(index, 0, size_);
+  return take(index);
+}
+
+void PackedArrayList::Unpack(int from, int count, Element *out) const {
+  if (count == 0) return;
+
+  internal::check_out_of_range(from, 0, size_);
+  internal::check_out_of_range(from + count - 1, from, size_);
+
+  int index = from;
+  const int end = from + count;
+
+  while (index < end) {
+    const int slot = index % kPerWord;
+    const int num_elements = std::min(kPerWord - slot, end - index);
+
+    Word word = words_[index / kPerWord] >> (slot * kBits);
+
+    // распаковка подряд идущих ячеек одного слова
+    for (int offset = 0; offset < num_elements; offset++) {
+      *out++ = static_cast<Element>(word & kElementMask);
+      word >>= kBits;
+    }
+    index += num_elements;
+  }
+}
+
+int PackedArrayList::IndexOf(Element e) const {
+  const Word pattern = broadcast(e);
+  const int num_full_words = size_ / kPerWord;
+
+  for (int word = 0; word < num_full_words; word++) {
+    const Word matches = match_mask(words_[word], pattern);
+    if (matches != 0) {
+      return word * kPerWord + lowest_bit(matches) / kBits;
+    }
+  }
+
+  // последнее неполное слово: ячейки за пределами размера не учитываются
+  const int tail = size_ % kPerWord;
+  if (tail != 0) {
+    const Word matches = match_mask(words_[num_full_words], pattern) & low_mask(tail * kBits);
+    if (matches != 0) {
+      return num_full_words * kPerWord + lowest_bit(matches) / kBits;
+    }
+  }
+  return kNotFoundElementIndex;
+}
+
+bool PackedArrayList::Contains(Element e) const {
+  return IndexOf(e) != kNotFoundElementIndex;
+}
+
+int PackedArrayList::GetSize() const {
+  return size_;
+}
+
+int PackedArrayList::GetCapacity() const {
+  return capacity_;
+}
+
+bool PackedArrayList::IsEmpty() const {
+  return size_ == 0;
+}
+
+long long PackedArrayList::GetMemoryUsage() const {
+  return static_cast<long long>(sizeof(Word)) * num_words(capacity_);
+}
+
+GrowthPolicy PackedArrayList::GetGrowthPolicy() const {
+  return growth_policy_;
+}
+
+void PackedArrayList::SetGrowthPolicy(GrowthPolicy growth_policy) {
+  growth_policy_ = growth_policy;
+}
+
+std::pmr::memory_resource *PackedArrayList::GetMemoryResource() const {
+  return resource_;
+}
+
+void PackedArrayList::resize(int new_capacity) {
+  assert(new_capacity > capacity_);
+
+  const int new_num_words = (new_capacity + kPerWord - 1) / kPerWord;
+  const int old_num_words = num_words(capacity_);
+
+  auto *new_words = static_cast<Word *>(resource_->allocate(sizeof(Word) * new_num_words, alignof(Word)));
+
+  std::copy(words_, words_ + old_num_words, new_words);
+  std::fill(new_words + old_num_words, new_words + new_num_words, kUninitializedWord);
+
+  if (words_ != nullptr) {
+    resource_->deallocate(words_, sizeof(Word) * old_num_words, alignof(Word));
+  }
+
+  words_ = new_words;
+  capacity_ = new_num_words * kPerWord;
+}
+
+void PackedArrayList::ensure_capacity(int min_capacity) {
+  if (min_capacity > capacity_) {
+    resize(growth_policy_.NextCapacity(capacity_, min_capacity));
+  }
+}
+
+void PackedArrayList::put(int index, Element e) {
+  const int bits = (index % kPerWord) * kBits;
+  Word &word = words_[index / kPerWord];
+  word = (word & ~(kElementMask << bits)) | (static_cast<Word>(e) << bits);
+}
+
+Element PackedArrayList::take(int index) const {
+  const int bits = (index % kPerWord) * kBits;
+  return static_cast<Element>((words_[index / kPerWord] >> bits) & kElementMask);
+}
+
+// === необходимо для тестирования ===
+
+std::ostream &operator<<(std::ostream &os, const PackedArrayList &list) {
+  if (list.words_ != nullptr) {
+    os << "{ ";
+    for (int index = 0; index < list.capacity_ - 1; index++) {
+      os << internal::elem_to_str(list.take(index)) << ", ";
+    }
+    os << internal::elem_to_str(list.take(list.capacity_ - 1)) << " }";
+  } else {
+    os << "{ nullptr }";
+  }
+  return os;
+}
+
+bool operator==(const PackedArrayList &list, const std::vector<Element> &elements) {
+  if (list.words_ == nullptr) return false;
+  if (list.capacity_ != static_cast<int>(elements.size())) return false;
+
+  for (int index = 0; index < list.capacity_; index++) {
+    if (list.take(index) != elements.at(index)) return false;
+  }
+  return true;
+}
+
+}  // namespace itis
@@ -0,0 +1,288 @@
+#include "segmented_array_list.hpp"
+
+#include <algorithm>  // copy, fill, min, max
+#include <cassert>    // assert
+#include <climits>    // INT_MAX
+#include <cstring>    // memmove, memcpy
+#include <stdexcept>  // out_of_range, invalid_argument
+#include <utility>    // swap
+
+#include "private/element_search.hpp"  // векторный поиск элементов
+#include "private/internal.hpp"        // вспомогательные функции
+
+namespace itis {
+
+SegmentedArrayList::SegmentedArrayList(std::pmr::memory_resource *resource) : resource_{resource} {
+  if (resource == nullptr) {
+    throw std::invalid_argument("SegmentedArrayList::resource must not be null");
+  }
+}
+
+SegmentedArrayList::SegmentedArrayList(SegmentedArrayList &&other) noexcept
+    : size_{other.size_},
+      num_chunks_{other.num_chunks_},
+      directory_capacity_{other.directory_capacity_},
+      directory_{other.directory_},
+      resource_{other.resource_} {
+  other.size_ = 0;
+  other.num_chunks_ = 0;
+  other.directory_capacity_ = 0;
+  other.directory_ = nullptr;
+}
+
+SegmentedArrayList &SegmentedArrayList::operator=(SegmentedArrayList &&other) noexcept {
+  if (this != &other) {
+    SegmentedArrayList moved{std::move(other)};
+    Swap(moved);
+  }
+  return *this;
+}
+
+SegmentedArrayList::~SegmentedArrayList() {
+  release_chunks(0);
+}
+
+void SegmentedArrayList::Swap(SegmentedArrayList &other) noexcept {
+  std::swap(size_, other.size_);
+  std::swap(num_chunks_, other.num_chunks_);
+  std::swap(directory_capacity_, other.directory_capacity_);
+  std::swap(directory_, other.directory_);
+  std::swap(resource_, other.resource_);
+}
+
+SegmentedArrayList SegmentedArrayList::Clone() const {
+  SegmentedArrayList clone(resource_);
+  clone.ensure_capacity(size_);
+
+  for (int chunk = 0; chunk < num_used_chunks(); chunk++) {
+    std::memcpy(clone.directory_[chunk], directory_[chunk], sizeof(Element) * chunk_size(chunk));
+  }
+  clone.size_ = size_;
+  return clone;
+}
+
+void SegmentedArrayList::Add(Element e) {
+  ensure_capacity(size_ + 1);
+  directory_[size_ >> kChunkShift][size_ & kChunkMask] = e;
+  size_ += 1;
+}
+
+void SegmentedArrayList::AddRange(const Element *elements, int count) {
+  if (count < 0) {
+    throw std::invalid_argument("SegmentedArrayList::count must not be negative");
+  }
+  ensure_capacity(size_ + count);
+
+  // копирование кусками до конца текущего блока
+  for (int copied = 0; copied < count;) {
+    const int offset = size_ & kChunkMask;
+    const int num_elements = std::min(count - copied, kChunkSize - offset);
+    std::memcpy(directory_[size_ >> kChunkShift] + offset, elements + copied, sizeof(Element) * num_elements);
+    copied += num_elements;
+    size_ += num_elements;
+  }
+}
+
+void SegmentedArrayList::Insert(int index, Element e) {
+  internal::check_out_of_range(index, 0, size_ + 1);
+  ensure_capacity(size_ + 1);
+
+  const int first_chunk = index >> kChunkShift;
+  const int last_chunk = size_ >> kChunkShift;  // блок, в который попадет последний элемент
+
+  // с последнего блока к первому: сдвиг внутри блока и перенос последнего элемента предыдущего блока в начало
+  for (int chunk = last_chunk; chunk > first_chunk; chunk--) {
+    Element *cells = directory_[chunk];
+    const int num_shifted = chunk == last_chunk ? size_ & kChunkMask : kChunkMask;
+    std::memmove(cells + 1, cells, sizeof(Element) * num_shifted);
+    cells[0] = directory_[chunk - 1][kChunkMask];
+  }
+
+  Element *cells = directory_[first_chunk];
+  const int offset = index & kChunkMask;
+  const int end = first_chunk == last_chunk ? size_ & kChunkMask : kChunkMask;
+  std::memmove(cells + offset + 1, cells + offset, sizeof(Element) * (end - offset));
+  cells[offset] = e;
+
+  size_ += 1;
+}
+
+void SegmentedArrayList::Set(int index, Element e) {
+  internal::check_out_of_range(index, 0, size_);
+  directory_[index >> kChunkShift][index & kChunkMask] = e;
+}
+
+Element SegmentedArrayList::Remove(int index) {
+  internal::check_out_of_range(index, 0, size_);
+
+  const int first_chunk = index >> kChunkShift;
+  const int last = size_ - 1;
+  const int last_chunk = last >> kChunkShift;
+
+  Element *cells = directory_[first_chunk];
+  const int offset = index & kChunkMask;
+  const Element result = cells[offset];
+
+  // с первого блока к последнему: сдвиг внутри блока и перенос первого элемента следующего блока в конец
+  const int end = first_chunk == last_chunk ? last & kChunkMask : kChunkMask;
+  std::memmove(cells + offset, cells + offset + 1, sizeof(Element) * (end - offset));
+
+  for (int chunk = first_chunk + 1; chunk <= last_chunk; chunk++) {
+    Element *next_cells = directory_[chunk];
+    directory_[chunk - 1][kChunkMask] = next_cells[0];
+    const int num_shifted = chunk == last_chunk ? last & kChunkMask : kChunkMask;
+    std::memmove(next_cells, next_cells + 1, sizeof(Element) * num_shifted);
+  }
+
+  directory_[last_chunk][last & kChunkMask] = Element::UNINITIALIZED;
+  size_ -= 1;
+  return result;
+}
+
+void SegmentedArrayList::Clear() {
+  for (int chunk = 0; chunk < num_used_chunks(); chunk++) {
+    std::fill(directory_[chunk], directory_[chunk] + chunk_size(chunk), Element::UNINITIALIZED);
+  }
+  size_ = 0;
+}
+
+void SegmentedArrayList::Reserve(int capacity) {
+  ensure_capacity(capacity);
+}
+
+void SegmentedArrayList::ShrinkToFit() {
+  release_chunks(num_used_chunks());
+}
+
+Element SegmentedArrayList::Get(int index) const {
+  internal::check_out_of_range(index, 0, size_);
+  return directory_[index >> kChunkShift][index & kChunkMask];
+}
+
+const Element *SegmentedArrayList::ElementPointer(int index) const {
+  internal::check_out_of_range(index, 0, size_);
+  return directory_[index >> kChunkShift] + (index & kChunkMask);
+}
+
+int SegmentedArrayList::IndexOf(Element e) const {
+  for (int chunk = 0; chunk < num_used_chunks(); chunk++) {
+    const int offset = internal::index_of(directory_[chunk], chunk_size(chunk), e);
+    if (offset != kNotFoundElementIndex) return (chunk << kChunkShift) + offset;
+  }
+  return kNotFoundElementIndex;
+}
+
+bool SegmentedArrayList::Contains(Element e) const {
+  return IndexOf(e) != kNotFoundElementIndex;
+}
+
+int SegmentedArrayList::Count(Element e) const {
+  int result = 0;
+  for (int chunk = 0; chunk < num_used_chunks(); chunk++) {
+    result += internal::count(directory_[chunk], chunk_size(chunk), e);
+  }
+  return result;
+}
+
+int SegmentedArrayList::GetSize() const {
+  return size_;
+}
+
+int SegmentedArrayList::GetCapacity() const {
+  return static_cast<int>(std::min<long long>(static_cast<long long>(num_chunks_) * kChunkSize, INT_MAX));
+}
+
+bool SegmentedArrayList::IsEmpty() const {
+  return size_ == 0;
+}
+
+std::pmr::memory_resource *SegmentedArrayList::GetMemoryResource() const {
+  return resource_;
+}
+
+int SegmentedArrayList::num_used_chunks() const {
+  return static_cast<int>((static_cast<long long>(size_) + kChunkMask) >> kChunkShift);
+}
+
+int SegmentedArrayList::chunk_size(int chunk) const {
+  return std::min(kChunkSize, size_ - (chunk << kChunkShift));
+}
+
+void SegmentedArrayList::ensure_capacity(int min_capacity) {
+  const auto num_chunks = static_cast<int>((static_cast<long long>(min_capacity) + kChunkMask) >> kChunkShift);
+  if (num_chunks <= num_chunks_) return;
+
+  // 1. расширение каталога: копируются только указатели на блоки
+  if (num_chunks > directory_capacity_) {
+    const int new_capacity = std::max({num_chunks, directory_capacity_ * 2, kInitDirectoryCapacity});
+    auto **new_directory = static_cast<Element **>(
+        resource_->allocate(sizeof(Element *) * new_capacity, alignof(Element *)));
+    std::copy(directory_, directory_ + num_chunks_, new_directory);
+
+    if (directory_ != nullptr) {
+      resource_->deallocate(directory_, sizeof(Element *) * directory_capacity_, alignof(Element *));
+    }
+    directory_ = new_directory;
+    directory_capacity_ = new_capacity;
+  }
+
+  // 2. новые блоки, свободные ячейки - Element::UNINITIALIZED
+  while (num_chunks_ < num_chunks) {
+    auto *cells = static_cast<Element *>(resource_->allocate(sizeof(Element) * kChunkSize, alignof(Element)));
+    std::fill(cells, cells + kChunkSize, Element::UNINITIALIZED);
+    directory_[num_chunks_] = cells;
+    num_chunks_ += 1;
+  }
+}
+
+void SegmentedArrayList::release_chunks(int first_chunk) {
+  assert(first_chunk >= num_used_chunks() || first_chunk == 0);
+
+  for (int chunk = first_chunk; chunk < num_chunks_; chunk++) {
+    resource_->deallocate(directory_[chunk], sizeof(Element) * kChunkSize, alignof(Element));
+  }
+  num_chunks_ = std::min(num_chunks_, first_chunk);
+
+  if (num_chunks_ == 0 && directory_ != nullptr) {
+    resource_->deallocate(directory_, sizeof(Element *) * directory_capacity_, alignof(Element *));
+    directory_ = nullptr;
+    directory_capacity_ = 0;
+  }
+}
+
+// необходимо для тестирования
+
+SegmentedArrayList::SegmentedArrayList(const std::vector<Element> &elements) {
+  AddRange(elements.data(), static_cast<int>(elements.size()));
+}
+
+std::ostream &operator<<(std::ostream &os, const SegmentedArrayList &list) {
+  if (list.num_chunks_ > 0) {
+    // элементы по блокам: { 0, 1, 2, 3 | 4, 5 }
+    os << "{ ";
+    for (int index = 0; index < list.size_; index++) {
+      if (index > 0) os << ((index & SegmentedArrayList::kChunkMask) == 0 ? " | " : ", ");
+      os << internal::elem_to_str(list.Get(index));
+    }
+    os << " }";
+  } else {
+    os << "{ nullptr }";
+  }
+  return os;
+}
+
+bool operator==(const SegmentedArrayList &list, const std::vector<Element> &elements) {
+  if (list.size_ != static_cast<int>(elements.size())) return false;
+  if (list.GetCapacity() < list.size_) return false;
+
+  // элементы, затем свободные ячейки выделенных блоков (должны быть Element::UNINITIALIZED)
+  for (int index = 0; index < list.num_chunks_ * SegmentedArrayList::kChunkSize; index++) {
+    const Element expected = index < list.size_ ? elements[index] : Element::UNINITIALIZED;
+    if (list.directory_[index >> SegmentedArrayList::kChunkShift][index & SegmentedArrayList::kChunkMask] != expected) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace itis
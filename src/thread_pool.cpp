@@ -0,0 +1,199 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>  // max, min
+#include <exception>  // exception_ptr, current_exception, rethrow_exception
+#include <stdexcept>  // invalid_argument
+
+namespace itis {
+
+namespace {
+
+// кол-во попыток найти задачу (с уступкой ядра), после которых вызывающий ParallelFor поток засыпает
+constexpr int kSpinCount = 64;
+
+// пул и индекс очереди рабочего потока, выполняющего код (nullptr - поток не из пула)
+thread_local const ThreadPool *current_pool = nullptr;
+thread_local int current_queue = 0;
+
+}  // namespace
+
+// группа задач одного вызова ParallelFor
+struct ThreadPool::Batch {
+  std::atomic<int> num_remaining;  // кол-во незавершенных задач
+  std::mutex error_mutex;
+  std::exception_ptr error;        // первое исключение тела цикла
+
+  // ожидание вызывающим потоком завершения частей, выполняемых другими потоками
+  std::mutex done_mutex;
+  std::condition_variable done_cv;
+  bool done{false};                // последняя часть завершена (под done_mutex)
+};
+
+ThreadPool::ThreadPool(int num_workers) {
+  if (num_workers < 0) {
+    throw std::invalid_argument("ThreadPool::num_workers must not be negative");
+  }
+
+  for (int index = 0; index <= num_workers; index++) {
+    queues_.push_back(std::make_unique<TaskQueue>());
+  }
+
+  workers_.reserve(num_workers);
+  for (int index = 0; index < num_workers; index++) {
+    workers_.emplace_back([this, index] { run_worker(index); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    const std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+ThreadPool &ThreadPool::Default() {
+  static ThreadPool pool(std::max(0, static_cast<int>(std::thread::hardware_concurrency()) - 1));
+  return pool;
+}
+
+int ThreadPool::GetNumWorkers() const {
+  return static_cast<int>(workers_.size());
+}
+
+void ThreadPool::ParallelFor(int begin, int end, int grain, const RangeFunction &body) {
+  if (grain <= 0) {
+    throw std::invalid_argument("ThreadPool::grain must be positive");
+  }
+  if (begin >= end) return;
+
+  const long long num_tasks = (static_cast<long long>(end) - begin + grain - 1) / grain;
+
+  // одна часть или нет рабочих потоков: части выполняются по порядку без очереди
+  if (num_tasks == 1 || workers_.empty()) {
+    std::exception_ptr error;
+    for (long long task_begin = begin; task_begin < end; task_begin += grain) {
+      try {
+        body(static_cast<int>(task_begin), static_cast<int>(std::min<long long>(end, task_begin + grain)));
+      } catch (...) {
+        if (!error) error = std::current_exception();
+      }
+    }
+    if (error) std::rethrow_exception(error);
+    return;
+  }
+
+  Batch batch;
+  batch.num_remaining.store(static_cast<int>(num_tasks), std::memory_order_relaxed);
+
+  const int home = home_queue();
+  {
+    TaskQueue &queue = *queues_[home];
+    const std::lock_guard<std::mutex> lock(queue.mutex);
+
+    // части кладутся с конца в обратном порядке: владелец очереди начинает с первой части,
+    // а воры забирают последние
+    for (long long task = num_tasks - 1; task >= 0; task--) {
+      const int task_begin = begin + static_cast<int>(task * grain);
+      const int task_end = static_cast<int>(std::min<long long>(end, static_cast<long long>(task_begin) + grain));
+      queue.tasks.push_back({&body, task_begin, task_end, &batch});
+    }
+  }
+  num_queued_.fetch_add(static_cast<int>(num_tasks), std::memory_order_release);
+
+  // захват мьютекса гарантирует, что рабочий поток либо еще не проверил условие ожидания, либо уже ждет
+  { const std::lock_guard<std::mutex> lock(sleep_mutex_); }
+  wake_.notify_all();
+
+  // вызывающий поток помогает, пока все его части не завершены (в том числе выполняя чужие задачи),
+  // а без задач в очередях после короткого ожидания засыпает до завершения последней части
+  int num_spins = 0;
+  while (batch.num_remaining.load(std::memory_order_acquire) > 0) {
+    Task task{};
+    if (try_pop(home, task)) {
+      execute(task);
+      num_spins = 0;
+    } else if (num_spins < kSpinCount) {
+      num_spins += 1;
+      std::this_thread::yield();
+    } else {
+      std::unique_lock<std::mutex> lock(batch.done_mutex);
+      batch.done_cv.wait(lock, [&batch] { return batch.done; });
+    }
+  }
+
+  // группа живет на стеке: поток, завершивший последнюю часть, мог еще не отпустить done_mutex
+  { const std::lock_guard<std::mutex> lock(batch.done_mutex); }
+
+  if (batch.error) {
+    std::rethrow_exception(batch.error);
+  }
+}
+
+void ThreadPool::run_worker(int index) {
+  current_pool = this;
+  current_queue = index;
+
+  while (true) {
+    Task task{};
+    if (try_pop(index, task)) {
+      execute(task);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    wake_.wait(lock, [this] { return stopping_ || num_queued_.load(std::memory_order_acquire) > 0; });
+    if (stopping_ && num_queued_.load(std::memory_order_acquire) == 0) return;
+  }
+}
+
+bool ThreadPool::try_pop(int home, Task &task) {
+  if (num_queued_.load(std::memory_order_acquire) == 0) return false;
+
+  const auto num_queues = static_cast<int>(queues_.size());
+  for (int offset = 0; offset < num_queues; offset++) {
+    TaskQueue &queue = *queues_[(home + offset) % num_queues];
+    const std::lock_guard<std::mutex> lock(queue.mutex);
+
+    if (queue.tasks.empty()) continue;
+
+    if (offset == 0) {
+      task = queue.tasks.back();
+      queue.tasks.pop_back();
+    } else {
+      task = queue.tasks.front();
+      queue.tasks.pop_front();
+    }
+    num_queued_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+  }
+  return false;
+}
+
+void ThreadPool::execute(const Task &task) {
+  try {
+    (*task.body)(task.begin, task.end);
+  } catch (...) {
+    const std::lock_guard<std::mutex> lock(task.batch->error_mutex);
+    if (!task.batch->error) {
+      task.batch->error = std::current_exception();
+    }
+  }
+
+  // release: результаты части видны потоку, дождавшемуся завершения группы
+  if (task.batch->num_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    const std::lock_guard<std::mutex> lock(task.batch->done_mutex);
+    task.batch->done = true;
+    task.batch->done_cv.notify_all();
+  }
+}
+
+int ThreadPool::home_queue() const {
+  return current_pool == this ? current_queue : static_cast<int>(queues_.size()) - 1;
+}
+
+}  // namespace itis
@@ -0,0 +1,326 @@
+#include "unrolled_linked_list.hpp"
+
+#include <algorithm>  // copy, copy_backward
+#include <cassert>    // assert
+#include <new>        // placement new
+#include <stdexcept>  // out_of_range, invalid_argument
+#include <utility>    // swap
+
+#include "private/element_search.hpp"  // векторный поиск элементов
+#include "private/internal.hpp"        // вспомогательные функции
+
+namespace itis {
+
+namespace {
+
+constexpr int kCapacity = UnrolledNode::kCapacity;
+
+}  // namespace
+
+UnrolledLinkedList::UnrolledLinkedList(std::pmr::memory_resource *resource) : resource_{resource} {
+  if (resource == nullptr) {
+    throw std::invalid_argument("UnrolledLinkedList::resource must not be null");
+  }
+}
+
+UnrolledLinkedList::UnrolledLinkedList(UnrolledLinkedList &&other) noexcept
+    : size_{other.size_},
+      num_nodes_{other.num_nodes_},
+      head_{other.head_},
+      tail_{other.tail_},
+      resource_{other.resource_} {
+  other.size_ = 0;
+  other.num_nodes_ = 0;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+}
+
+UnrolledLinkedList &UnrolledLinkedList::operator=(UnrolledLinkedList &&other) noexcept {
+  if (this != &other) {
+    UnrolledLinkedList moved{std::move(other)};
+    Swap(moved);
+  }
+  return *this;
+}
+
+UnrolledLinkedList::~UnrolledLinkedList() {
+  Clear();
+}
+
+void UnrolledLinkedList::Swap(UnrolledLinkedList &other) noexcept {
+  std::swap(size_, other.size_);
+  std::swap(num_nodes_, other.num_nodes_);
+  std::swap(head_, other.head_);
+  std::swap(tail_, other.tail_);
+  std::swap(resource_, other.resource_);
+}
+
+UnrolledLinkedList UnrolledLinkedList::Clone() const {
+  UnrolledLinkedList clone(resource_);
+  for (UnrolledNode *node = head_; node != nullptr; node = node->next) {
+    for (int offset = 0; offset < node->count; offset++) {
+      clone.Add(node->data[offset]);
+    }
+  }
+  return clone;
+}
+
+void UnrolledLinkedList::Add(Element e) {
+  if (tail_ == nullptr) {
+    head_ = tail_ = create_node(nullptr);
+  } else if (tail_->count == kCapacity) {
+    // при добавлении в конец узлы остаются заполненными полностью (без деления пополам)
+    tail_->next = create_node(nullptr);
+    tail_ = tail_->next;
+  }
+
+  tail_->data[tail_->count] = e;
+  tail_->count += 1;
+  size_ += 1;
+}
+
+void UnrolledLinkedList::Insert(int index, Element e) {
+  internal::check_out_of_range(index, 0, size_ + 1);
+
+  if (index == size_) {
+    Add(e);
+    return;
+  }
+
+  int offset = 0;
+  UnrolledNode *node = find_node(index, offset);
+
+  if (node->count == kCapacity) {
+    split_node(node);
+
+    if (offset > node->count) {
+      // позиция вставки попала во вторую половину
+      offset -= node->count;
+      node = node->next;
+    }
+  }
+
+  std::copy_backward(node->data + offset, node->data + node->count, node->data + node->count + 1);
+  node->data[offset] = e;
+  node->count += 1;
+  size_ += 1;
+}
+
+void UnrolledLinkedList::Set(int index, Element e) {
+  internal::check_out_of_range(index, 0, size_);
+
+  int offset = 0;
+  UnrolledNode *node = find_node(index, offset);
+  node->data[offset] = e;
+}
+
+Element UnrolledLinkedList::Remove(int index) {
+  internal::check_out_of_range(index, 0, size_);
+
+  int offset = 0;
+  UnrolledNode *prev = nullptr;
+  UnrolledNode *node = find_node(index, offset, &prev);
+
+  const Element result = node->data[offset];
+  std::copy(node->data + offset + 1, node->data + node->count, node->data + offset);
+  node->count -= 1;
+  size_ -= 1;
+
+  rebalance_node(node, prev);
+  return result;
+}
+
+void UnrolledLinkedList::Clear() {
+  // монотонный источник памяти освобождает память только целиком, обходить узлы незачем
+  if (!internal::releases_memory_in_bulk(resource_)) {
+    UnrolledNode *node = head_;
+    while (node != nullptr) {
+      UnrolledNode *next = node->next;
+      destroy_node(node);
+      node = next;
+    }
+  }
+  head_ = nullptr;
+  tail_ = nullptr;
+  size_ = 0;
+  num_nodes_ = 0;
+}
+
+Element UnrolledLinkedList::Get(int index) const {
+  internal::check_out_of_range(index, 0, size_);
+
+  int offset = 0;
+  const UnrolledNode *node = find_node(index, offset);
+  return node->data[offset];
+}
+
+int UnrolledLinkedList::IndexOf(Element e) const {
+  int base = 0;  // индекс первого элемента узла
+  for (const UnrolledNode *node = head_; node != nullptr; node = node->next) {
+    const int offset = internal::index_of(node->data, node->count, e);
+    if (offset != kNotFoundElementIndex) return base + offset;
+    base += node->count;
+  }
+  return kNotFoundElementIndex;
+}
+
+bool UnrolledLinkedList::Contains(Element e) const {
+  return IndexOf(e) != kNotFoundElementIndex;
+}
+
+int UnrolledLinkedList::Count(Element e) const {
+  int result = 0;
+  for (const UnrolledNode *node = head_; node != nullptr; node = node->next) {
+    result += internal::count(node->data, node->count, e);
+  }
+  return result;
+}
+
+int UnrolledLinkedList::GetSize() const {
+  return size_;
+}
+
+bool UnrolledLinkedList::IsEmpty() const {
+  return size_ == 0;
+}
+
+int UnrolledLinkedList::GetNumNodes() const {
+  return num_nodes_;
+}
+
+Element UnrolledLinkedList::tail() const {
+  return tail_ ? tail_->data[tail_->count - 1] : Element::UNINITIALIZED;
+}
+
+Element UnrolledLinkedList::head() const {
+  return head_ ? head_->data[0] : Element::UNINITIALIZED;
+}
+
+std::pmr::memory_resource *UnrolledLinkedList::GetMemoryResource() const {
+  return resource_;
+}
+
+UnrolledNode *UnrolledLinkedList::create_node(UnrolledNode *next) {
+  void *memory = resource_->allocate(sizeof(UnrolledNode), alignof(UnrolledNode));
+  auto *node = new(memory) UnrolledNode;
+  node->next = next;
+  num_nodes_ += 1;
+  return node;
+}
+
+void UnrolledLinkedList::destroy_node(UnrolledNode *node) {
+  node->~UnrolledNode();
+  resource_->deallocate(node, sizeof(UnrolledNode), alignof(UnrolledNode));
+  num_nodes_ -= 1;
+}
+
+UnrolledNode *UnrolledLinkedList::find_node(int index, int &offset, UnrolledNode **prev) const {
+  assert(index >= 0 && index < size_);
+
+  // последний узел (частый случай) без обхода, если предыдущий узел не нужен
+  const int tail_begin = size_ - tail_->count;
+  if (prev == nullptr && index >= tail_begin) {
+    offset = index - tail_begin;
+    return tail_;
+  }
+
+  UnrolledNode *prev_node = nullptr;
+  UnrolledNode *node = head_;
+
+  // пропускаем узлы целиком: O(n / B) переходов
+  while (index >= node->count) {
+    index -= node->count;
+    prev_node = node;
+    node = node->next;
+  }
+
+  if (prev != nullptr) *prev = prev_node;
+  offset = index;
+  return node;
+}
+
+void UnrolledLinkedList::split_node(UnrolledNode *node) {
+  assert(node->count == kCapacity);
+
+  UnrolledNode *half = create_node(node->next);
+
+  const int keep = node->count / 2;
+  std::copy(node->data + keep, node->data + node->count, half->data);
+  half->count = node->count - keep;
+  node->count = keep;
+  node->next = half;
+
+  if (tail_ == node) tail_ = half;
+}
+
+void UnrolledLinkedList::rebalance_node(UnrolledNode *node, UnrolledNode *prev) {
+  if (node->count == 0) {
+    unlink_node(node, prev);
+    return;
+  }
+
+  UnrolledNode *next = node->next;
+  if (node->count >= kMinElementsPerNode || next == nullptr) return;
+
+  if (node->count + next->count <= kCapacity) {
+    // слияние: все элементы следующего узла переносятся в этот узел
+    std::copy(next->data, next->data + next->count, node->data + node->count);
+    node->count += next->count;
+    unlink_node(next, node);
+  } else {
+    // перераспределение: забираем у следующего узла часть элементов, чтобы узлы сравнялись
+    const int num_moved = (next->count - node->count) / 2;
+    std::copy(next->data, next->data + num_moved, node->data + node->count);
+    std::copy(next->data + num_moved, next->data + next->count, next->data);
+    node->count += num_moved;
+    next->count -= num_moved;
+  }
+}
+
+void UnrolledLinkedList::unlink_node(UnrolledNode *node, UnrolledNode *prev) {
+  if (prev == nullptr) {
+    head_ = node->next;
+  } else {
+    prev->next = node->next;
+  }
+  if (tail_ == node) tail_ = prev;
+
+  destroy_node(node);
+}
+
+// === необходимо для тестирования ===
+
+UnrolledLinkedList::UnrolledLinkedList(const std::vector<Element> &elements) {
+  for (const auto e : elements) {
+    Add(e);
+  }
+}
+
+std::ostream &operator<<(std::ostream &os, const UnrolledLinkedList &list) {
+  if (list.head_ != nullptr) {
+    os << "{ ";
+    for (const UnrolledNode *node = list.head_; node != nullptr; node = node->next) {
+      for (int offset = 0; offset < node->count; offset++) {
+        const bool last = node->next == nullptr && offset == node->count - 1;
+        os << internal::elem_to_str(node->data[offset]) << (last ? " }" : ", ");
+      }
+    }
+  } else {
+    os << "{ nullptr }";
+  }
+  return os;
+}
+
+bool operator==(const UnrolledLinkedList &list, const std::vector<Element> &elements) {
+  if (list.size_ != static_cast<int>(elements.size())) return false;
+
+  auto it = elements.begin();
+  for (const UnrolledNode *node = list.head_; node != nullptr; node = node->next) {
+    for (int offset = 0; offset < node->count; offset++, ++it) {
+      if (node->data[offset] != *it) return false;
+    }
+  }
+  return it == elements.end();
+}
+
+}  // namespace itis
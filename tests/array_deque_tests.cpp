@@ -0,0 +1,174 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "element.hpp"
+
+#include "array_deque.hpp"
+
+using namespace std;
+using namespace itis;
+using namespace Catch::Matchers;
+
+SCENARIO("create empty array deque") {
+
+  WHEN("using a default constructor") {
+    const auto deque = make_unique<ArrayDeque>();
+
+    THEN("deque should be empty") {
+      CHECK(deque->IsEmpty());
+      CHECK(deque->GetCapacity() == ArrayDeque::kInitCapacity);
+      CHECK(*deque == vector<Element>(ArrayDeque::kInitCapacity, Element::UNINITIALIZED));
+    }
+  }
+
+  AND_WHEN("using non-positive capacity") {
+    const int capacity = GENERATE(range(-5, 1));
+
+    THEN("exception must be thrown") {
+      CHECK_THROWS_AS(ArrayDeque(capacity), std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("push and pop at both ends of array deque") {
+
+  GIVEN("deque with wrapped elements") {
+    ArrayDeque deque(4);
+
+    deque.Add(Element::DRAGON_BALL);
+    deque.AddFirst(Element::CHERRY_PIE);
+    deque.AddLast(Element::GRAVITY_GUN);
+
+    WHEN("observing the deque") {
+
+      THEN("elements should be in logical order") {
+        CHECK(deque.GetSize() == 3);
+        CHECK(deque.GetFirst() == Element::CHERRY_PIE);
+        CHECK(deque.GetLast() == Element::GRAVITY_GUN);
+        CHECK(deque == vector<Element>{Element::CHERRY_PIE, Element::DRAGON_BALL,
+                                       Element::GRAVITY_GUN, Element::UNINITIALIZED});
+      }
+    }
+
+    AND_WHEN("growing past capacity") {
+      deque.AddFirst(Element::SECRET_BOX);
+      deque.AddFirst(Element::BEAUTIFUL_FLOWERS);
+
+      THEN("elements should be unwrapped into the new buffer") {
+        CHECK(deque.GetCapacity() == 8);
+        CHECK(deque == vector<Element>{Element::BEAUTIFUL_FLOWERS, Element::SECRET_BOX, Element::CHERRY_PIE,
+                                       Element::DRAGON_BALL, Element::GRAVITY_GUN, Element::UNINITIALIZED,
+                                       Element::UNINITIALIZED, Element::UNINITIALIZED});
+      }
+    }
+
+    AND_WHEN("popping from both ends") {
+      CHECK(deque.RemoveFirst() == Element::CHERRY_PIE);
+      CHECK(deque.RemoveLast() == Element::GRAVITY_GUN);
+      CHECK(deque.RemoveLast() == Element::DRAGON_BALL);
+
+      THEN("deque should be empty") {
+        CHECK(deque.IsEmpty());
+        CHECK(deque == vector<Element>(4, Element::UNINITIALIZED));
+        CHECK_THROWS_AS(deque.RemoveFirst(), std::out_of_range);
+        CHECK_THROWS_AS(deque.RemoveLast(), std::out_of_range);
+        CHECK_THROWS_AS(deque.GetFirst(), std::out_of_range);
+      }
+    }
+  }
+}
+
+SCENARIO("array deque behaves like std::deque") {
+
+  GIVEN("array deque and reference deque") {
+    const int num_operations = GENERATE(10, 100, 2000);
+    const auto seed = GENERATE(take(3, random(0u, 100000u)));
+
+    ArrayDeque deque(1);
+    std::deque<Element> elements_ref;
+
+    auto engine = mt19937(seed);
+    auto element_dist = uniform_int_distribution<>(0, static_cast<int>(Element::UNINITIALIZED) - 1);
+    auto operation_dist = uniform_int_distribution<>(0, 11);
+
+    WHEN("applying random operations") {
+      for (int operation = 0; operation < num_operations; operation++) {
+        const auto e = static_cast<Element>(element_dist(engine));
+        const int kind = operation_dist(engine);
+        const int size = static_cast<int>(elements_ref.size());
+
+        if (kind < 2 || size == 0) {
+          deque.Add(e);
+          elements_ref.push_back(e);
+        } else if (kind < 4) {
+          deque.AddFirst(e);
+          elements_ref.push_front(e);
+        } else if (kind < 6) {
+          const int index = uniform_int_distribution<>(0, size)(engine);
+          deque.Insert(index, e);
+          elements_ref.insert(elements_ref.begin() + index, e);
+        } else if (kind < 8) {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          REQUIRE(deque.Remove(index) == elements_ref.at(index));
+          elements_ref.erase(elements_ref.begin() + index);
+        } else if (kind < 9) {
+          REQUIRE(deque.RemoveFirst() == elements_ref.front());
+          elements_ref.pop_front();
+        } else if (kind < 10) {
+          REQUIRE(deque.RemoveLast() == elements_ref.back());
+          elements_ref.pop_back();
+        } else {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          deque.Set(index, e);
+          elements_ref.at(index) = e;
+        }
+      }
+
+      CAPTURE(num_operations, seed);
+
+      THEN("elements and unused cells should match the reference") {
+        REQUIRE(deque.GetSize() == static_cast<int>(elements_ref.size()));
+
+        vector<Element> cells_ref(elements_ref.begin(), elements_ref.end());
+        cells_ref.resize(deque.GetCapacity(), Element::UNINITIALIZED);
+        CHECK(deque == cells_ref);
+      }
+
+      AND_THEN("search should match the reference") {
+        for (int id = 0; id < static_cast<int>(Element::UNINITIALIZED); id++) {
+          const auto e = static_cast<Element>(id);
+          const auto first = std::find(elements_ref.begin(), elements_ref.end(), e);
+          const auto last = std::find(elements_ref.rbegin(), elements_ref.rend(), e);
+
+          const int index_ref = first == elements_ref.end() ? ArrayDeque::kNotFoundElementIndex
+                                                            : static_cast<int>(first - elements_ref.begin());
+          const int last_index_ref = last == elements_ref.rend() ? ArrayDeque::kNotFoundElementIndex
+                                                                 : static_cast<int>(elements_ref.rend() - last) - 1;
+          CHECK(deque.IndexOf(e) == index_ref);
+          CHECK(deque.LastIndexOf(e) == last_index_ref);
+          CHECK(deque.Contains(e) == (first != elements_ref.end()));
+          CHECK(deque.Count(e) == std::count(elements_ref.begin(), elements_ref.end(), e));
+        }
+      }
+
+      AND_THEN("clone should keep the elements") {
+        const ArrayDeque clone = deque.Clone();
+        for (int index = 0; index < clone.GetSize(); index++) {
+          REQUIRE(clone.Get(index) == elements_ref.at(index));
+        }
+      }
+
+      AND_THEN("clearing should reset all cells") {
+        const int capacity = deque.GetCapacity();
+        deque.Clear();
+        CHECK(deque.IsEmpty());
+        CHECK(deque == vector<Element>(capacity, Element::UNINITIALIZED));
+      }
+    }
+  }
+}
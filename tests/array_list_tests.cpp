@@ -1,12 +1,18 @@
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <memory_resource>
+#include <thread>
 #include <vector>
 
 #include "element.hpp"
 #include "generation.hpp"
+#include "counting_resource.hpp"
 
 #include "array_list.hpp"
+#include "growth_policy.hpp"
 
 using namespace std;
 using namespace itis;
@@ -565,3 +571,798 @@ SCENARIO("set array list element value") {
     }
   }
 }
+
+SCENARIO("grow array list capacity according to the growth policy") {
+
+  GIVEN("array list with geometric growth policy") {
+    const double growth_factor = GENERATE(1.5, 2.0, 3.0);
+    const int num_elements = GENERATE(1000, 100000);
+
+    const auto list = make_unique<ArrayList>(ArrayList::kInitCapacity, GrowthPolicy::Geometric(growth_factor));
+
+    WHEN("adding many elements") {
+      int num_resizes = 0;
+      long long num_copied_elements = 0;  // при расширении копируются все элементы (size == capacity)
+
+      for (int index = 0; index < num_elements; index++) {
+        const int capacity_before = list->GetCapacity();
+        list->Add(Element::DRAGON_BALL);
+
+        if (list->GetCapacity() != capacity_before) {
+          num_resizes += 1;
+          num_copied_elements += capacity_before;
+        }
+      }
+
+      CAPTURE(growth_factor, num_elements, num_resizes, num_copied_elements);
+
+      THEN("all elements should be added") {
+        CHECK(list->GetSize() == num_elements);
+        CHECK(list->GetCapacity() >= num_elements);
+      }
+
+      AND_THEN("number of resizes should be logarithmic") {
+        const double max_num_resizes = std::log(num_elements) / std::log(growth_factor) + 1;
+        CHECK(num_resizes <= max_num_resizes);
+      }
+
+      AND_THEN("amortized cost of adding an element should be constant") {
+        // геометрическая прогрессия: суммарно копируется не более N * factor / (factor - 1) элементов
+        const double max_copied_elements = num_elements * growth_factor / (growth_factor - 1);
+        CHECK(num_copied_elements <= max_copied_elements);
+      }
+    }
+
+    AND_WHEN("inserting elements into the front") {
+      for (int index = 0; index < ArrayList::kInitCapacity + 1; index++) {
+        list->Insert(0, Element::SECRET_BOX);
+      }
+
+      THEN("capacity should grow geometrically") {
+        const auto expected_capacity = static_cast<int>(ArrayList::kInitCapacity * growth_factor);
+        CHECK(list->GetCapacity() == expected_capacity);
+      }
+    }
+  }
+
+  AND_GIVEN("array list with additive growth policy") {
+    const int increment = GENERATE(1, 7, 100);
+    const auto list = make_unique<ArrayList>(1, GrowthPolicy::Additive(increment));
+
+    WHEN("exceeding capacity") {
+      list->Add(Element::CHERRY_PIE);
+      list->Add(Element::CHERRY_PIE);
+
+      THEN("capacity should be increased by the increment") {
+        CHECK(list->GetCapacity() == 1 + increment);
+      }
+    }
+  }
+
+  AND_GIVEN("array list with custom growth policy") {
+    const auto policy = GrowthPolicy::Custom([](int capacity, int min_capacity) { return capacity * 4 + 1; });
+    const auto list = make_unique<ArrayList>(2, policy);
+
+    REQUIRE(list->GetGrowthPolicy().IsCustom());
+
+    WHEN("exceeding capacity") {
+      for (int index = 0; index < 3; index++) {
+        list->Add(Element::GRAVITY_GUN);
+      }
+
+      THEN("capacity should be computed by the custom function") {
+        CHECK(list->GetCapacity() == 9);
+        CHECK(*list == vector<Element>{Element::GRAVITY_GUN, Element::GRAVITY_GUN, Element::GRAVITY_GUN,
+                                       Element::UNINITIALIZED, Element::UNINITIALIZED, Element::UNINITIALIZED,
+                                       Element::UNINITIALIZED, Element::UNINITIALIZED, Element::UNINITIALIZED});
+      }
+    }
+  }
+
+  AND_GIVEN("invalid growth policy parameters") {
+
+    THEN("exception should be thrown") {
+      CHECK_THROWS_AS(GrowthPolicy::Additive(0), std::invalid_argument);
+      CHECK_THROWS_AS(GrowthPolicy::Geometric(1.0), std::invalid_argument);
+      CHECK_THROWS_AS(GrowthPolicy::Custom(nullptr), std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("bulk edit array list with range operations") {
+
+  GIVEN("non-empty array list") {
+    const int init_capacity = GENERATE(range(2, 10));
+    const int num_elements = GENERATE_COPY(range(1, init_capacity + 1));
+
+    vector<Element> elements_ref = utils::generate_elements(num_elements, init_capacity);
+    const auto list = make_unique<ArrayList>(elements_ref.data(), num_elements, init_capacity);
+
+    CAPTURE(init_capacity, num_elements);
+
+    WHEN("adding a range of elements") {
+      const int num_added = GENERATE(0, 1, 25);
+      const vector<Element> added_ref = utils::generate_elements(num_added, num_added);
+
+      list->AddRange(added_ref.data(), num_added);
+      elements_ref.insert(elements_ref.end(), added_ref.begin(), added_ref.end());
+
+      THEN("elements should be appended to the back of the list") {
+        CHECK(list->GetSize() == num_elements + num_added);
+        elements_ref.resize(list->GetCapacity(), Element::UNINITIALIZED);
+        CHECK(*list == elements_ref);
+      }
+
+      AND_THEN("capacity should be extended at most once") {
+        const int required_capacity = num_elements + num_added;
+        const int expected_capacity = required_capacity <= init_capacity
+                                      ? init_capacity
+                                      : std::max(required_capacity, init_capacity + ArrayList::kCapacityGrowthCoefficient);
+        CHECK(list->GetCapacity() == expected_capacity);
+      }
+    }
+
+    AND_WHEN("inserting a range of elements") {
+      const int index = GENERATE_COPY(range(0, num_elements + 1));
+      const int num_inserted = GENERATE(1, 3, 12);
+      const vector<Element> inserted_ref = utils::generate_elements(num_inserted, num_inserted);
+
+      list->InsertRange(index, inserted_ref.data(), inserted_ref.data() + num_inserted);
+      elements_ref.insert(elements_ref.begin() + index, inserted_ref.begin(), inserted_ref.end());
+
+      CAPTURE(index, num_inserted);
+
+      THEN("elements should be inserted at the right position") {
+        CHECK(list->GetSize() == num_elements + num_inserted);
+        elements_ref.resize(list->GetCapacity(), Element::UNINITIALIZED);
+        CHECK(*list == elements_ref);
+      }
+    }
+
+    AND_WHEN("removing a range of elements") {
+      const int from = GENERATE_COPY(range(0, num_elements + 1));
+      const int to = GENERATE_COPY(range(from, num_elements + 1));
+
+      list->RemoveRange(from, to);
+      elements_ref.erase(elements_ref.begin() + from, elements_ref.begin() + to);
+
+      CAPTURE(from, to);
+
+      THEN("elements should be removed and freed cells should be uninitialized") {
+        CHECK(list->GetSize() == num_elements - (to - from));
+        CHECK(list->GetCapacity() == init_capacity);
+        elements_ref.resize(init_capacity, Element::UNINITIALIZED);
+        CHECK(*list == elements_ref);
+      }
+    }
+
+    AND_WHEN("using invalid ranges") {
+      const int index = GENERATE_COPY(-1, num_elements + 1);
+
+      THEN("exception should be thrown") {
+        CAPTURE(index);
+        CHECK_THROWS_AS(list->InsertRange(index, elements_ref.data(), elements_ref.data()), std::out_of_range);
+        CHECK_THROWS_AS(list->RemoveRange(index, num_elements), std::out_of_range);
+        CHECK_THROWS_AS(list->RemoveRange(0, index), std::out_of_range);
+        CHECK_THROWS_AS(list->AddRange(elements_ref.data(), -1), std::invalid_argument);
+        CHECK_THROWS_AS(list->AddRange(nullptr, -1), std::invalid_argument);
+      }
+    }
+  }
+}
+
+SCENARIO("move, swap and clone array list") {
+
+  GIVEN("non-empty array list") {
+    const int init_capacity = GENERATE(range(2, 10));
+    const int num_elements = GENERATE_COPY(range(1, init_capacity + 1));
+
+    vector<Element> elements_ref = utils::generate_elements(num_elements, init_capacity);
+    ArrayList list(elements_ref.data(), num_elements, init_capacity);
+
+    elements_ref.resize(init_capacity, Element::UNINITIALIZED);
+
+    CAPTURE(init_capacity, num_elements);
+
+    WHEN("moving array list into a new one") {
+      ArrayList moved_list{std::move(list)};
+
+      THEN("elements should be transferred") {
+        CHECK(moved_list.GetSize() == num_elements);
+        CHECK(moved_list.GetCapacity() == init_capacity);
+        CHECK(moved_list == elements_ref);
+      }
+
+      AND_THEN("moved-from list should become empty and reusable") {
+        CHECK(list.GetSize() == 0);
+        CHECK(list.GetCapacity() == 0);
+
+        list.Add(Element::CHERRY_PIE);
+        CHECK(list.Get(0) == Element::CHERRY_PIE);
+      }
+    }
+
+    AND_WHEN("move-assigning array list") {
+      ArrayList other(3);
+      other.Add(Element::SECRET_BOX);
+      other = std::move(list);
+
+      THEN("elements should be transferred") {
+        CHECK(other.GetSize() == num_elements);
+        CHECK(other == elements_ref);
+        CHECK(list.IsEmpty());
+      }
+    }
+
+    AND_WHEN("storing array lists in a vector") {
+      vector<ArrayList> lists;
+      lists.push_back(std::move(list));
+      lists.emplace_back(1);
+      lists.emplace_back(2);
+
+      THEN("elements should survive reallocation of the vector") {
+        CHECK(lists.front() == elements_ref);
+      }
+    }
+
+    AND_WHEN("swapping array lists") {
+      ArrayList other(1);
+      other.Add(Element::GRAVITY_GUN);
+
+      swap(list, other);
+
+      THEN("contents should be exchanged") {
+        CHECK(other == elements_ref);
+        CHECK(list == vector<Element>{Element::GRAVITY_GUN});
+      }
+    }
+
+    AND_WHEN("cloning array list") {
+      ArrayList clone = list.Clone();
+
+      THEN("clone should have the same elements and capacity") {
+        CHECK(clone.GetSize() == num_elements);
+        CHECK(clone.GetCapacity() == init_capacity);
+        CHECK(clone == elements_ref);
+      }
+
+      AND_THEN("clone should be independent from the original") {
+        clone.Set(0, Element::BEAUTIFUL_FLOWERS);
+        CHECK(list == elements_ref);
+      }
+    }
+  }
+}
+
+SCENARIO("allocate array list memory through a memory resource") {
+
+  GIVEN("counting memory resource") {
+    utils::CountingResource resource;
+
+    WHEN("adding elements beyond initial capacity") {
+      const int num_elements = GENERATE(1, 10, 100);
+
+      {
+        ArrayList list(2, &resource);
+        for (int index = 0; index < num_elements; index++) {
+          list.Add(Element::SECRET_BOX);
+        }
+
+        CAPTURE(num_elements, resource.num_allocations);
+
+        THEN("all allocations should go through the resource") {
+          CHECK(list.GetMemoryResource() == &resource);
+          CHECK(resource.num_allocations >= 1);
+          CHECK(resource.num_allocations == resource.num_deallocations + 1);
+          CHECK(resource.bytes_in_use == sizeof(Element) * list.GetCapacity());
+        }
+
+        AND_THEN("clone should use the same resource") {
+          const ArrayList clone = list.Clone();
+          CHECK(clone.GetMemoryResource() == &resource);
+          CHECK(resource.num_allocations == resource.num_deallocations + 2);
+        }
+      }
+
+      AND_THEN("all memory should be returned to the resource") {
+        CHECK(resource.num_allocations == resource.num_deallocations);
+        CHECK(resource.bytes_in_use == 0);
+      }
+    }
+
+    AND_WHEN("moving array list") {
+      ArrayList list(&resource);
+      ArrayList moved_list{std::move(list)};
+
+      THEN("resource should be moved along with the elements") {
+        CHECK(moved_list.GetMemoryResource() == &resource);
+        CHECK(resource.num_allocations == 1);
+      }
+    }
+  }
+
+  AND_GIVEN("monotonic buffer resource") {
+    std::pmr::monotonic_buffer_resource arena;
+    utils::CountingResource heap;
+
+    std::pmr::memory_resource *const previous = std::pmr::set_default_resource(&heap);
+
+    WHEN("adding elements") {
+      ArrayList list(1, GrowthPolicy::Geometric(), &arena);
+      for (int index = 0; index < 1000; index++) {
+        list.Add(Element::DRAGON_BALL);
+      }
+
+      THEN("global heap should not be touched") {
+        CHECK(list.GetSize() == 1000);
+        CHECK(heap.num_allocations == 0);
+      }
+    }
+
+    std::pmr::set_default_resource(previous);
+  }
+
+  AND_GIVEN("null memory resource") {
+
+    THEN("exception should be thrown") {
+      CHECK_THROWS_AS(ArrayList(nullptr), std::invalid_argument);
+      CHECK_THROWS_AS(ArrayList(1, nullptr), std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("search array list from the back and count elements") {
+
+  GIVEN("array list with repeated elements") {
+    const vector<Element> elements_ref{Element::CHERRY_PIE, Element::SECRET_BOX, Element::CHERRY_PIE,
+                                       Element::DRAGON_BALL, Element::CHERRY_PIE};
+
+    ArrayList list(10);
+    list.AddRange(elements_ref.data(), static_cast<int>(elements_ref.size()));
+
+    THEN("last occurrences and counts should be found") {
+      CHECK(list.IndexOf(Element::CHERRY_PIE) == 0);
+      CHECK(list.LastIndexOf(Element::CHERRY_PIE) == 4);
+      CHECK(list.LastIndexOf(Element::DRAGON_BALL) == 3);
+      CHECK(list.LastIndexOf(Element::GRAVITY_GUN) == ArrayList::kNotFoundElementIndex);
+
+      CHECK(list.Count(Element::CHERRY_PIE) == 3);
+      CHECK(list.Count(Element::SECRET_BOX) == 1);
+      CHECK(list.Count(Element::GRAVITY_GUN) == 0);
+    }
+
+    AND_THEN("unused cells should not be counted") {
+      CHECK(list.Count(Element::UNINITIALIZED) == 0);
+      CHECK(list.LastIndexOf(Element::UNINITIALIZED) == ArrayList::kNotFoundElementIndex);
+    }
+  }
+}
+
+SCENARIO("maintain element counts of the array list") {
+
+  GIVEN("array list with enabled element counts") {
+    const int init_num_elements = GENERATE(0, 1, 15);
+    vector<Element> elements_ref = utils::generate_elements(init_num_elements, init_num_elements);
+
+    ArrayList list(1);
+    list.AddRange(elements_ref.data(), init_num_elements);
+    list.EnableElementCounts();
+
+    REQUIRE(list.HasElementCounts());
+
+    WHEN("mutating the list") {
+      const vector<Element> range_ref = utils::generate_elements(5, 5);
+
+      list.Add(Element::CHERRY_PIE);
+      list.Insert(0, Element::SECRET_BOX);
+      list.Insert(1, Element::SECRET_BOX);
+      list.AddRange(range_ref.data(), 5);
+      list.InsertRange(2, range_ref.data(), range_ref.data() + 3);
+      list.Set(1, Element::GRAVITY_GUN);
+      list.Remove(0);
+      list.RemoveRange(1, 4);
+
+      // то же самое над эталоном
+      elements_ref.push_back(Element::CHERRY_PIE);
+      elements_ref.insert(elements_ref.begin(), Element::SECRET_BOX);
+      elements_ref.insert(elements_ref.begin() + 1, Element::SECRET_BOX);
+      elements_ref.insert(elements_ref.end(), range_ref.begin(), range_ref.end());
+      elements_ref.insert(elements_ref.begin() + 2, range_ref.begin(), range_ref.begin() + 3);
+      elements_ref.at(1) = Element::GRAVITY_GUN;
+      elements_ref.erase(elements_ref.begin());
+      elements_ref.erase(elements_ref.begin() + 1, elements_ref.begin() + 4);
+
+      THEN("counts should match the number of occurrences") {
+        for (int id = 0; id < kNumElementValues; id++) {
+          const auto e = static_cast<Element>(id);
+          const auto count_ref = static_cast<int>(std::count(elements_ref.begin(), elements_ref.end(), e));
+
+          CAPTURE(id);
+          CHECK(list.Count(e) == count_ref);
+          CHECK(list.Contains(e) == (count_ref > 0));
+
+          if (count_ref == 0) {
+            CHECK(list.IndexOf(e) == ArrayList::kNotFoundElementIndex);
+          }
+        }
+      }
+
+      AND_THEN("counts should survive clone and move") {
+        ArrayList moved = list.Clone();
+        ArrayList other{std::move(moved)};
+
+        CHECK(other.HasElementCounts());
+        CHECK(other.Count(Element::CHERRY_PIE) == list.Count(Element::CHERRY_PIE));
+      }
+    }
+
+    AND_WHEN("clearing the list") {
+      list.Clear();
+
+      THEN("all counts should be reset") {
+        for (int id = 0; id < kNumElementValues; id++) {
+          CHECK(list.Count(static_cast<Element>(id)) == 0);
+        }
+      }
+    }
+
+    AND_WHEN("disabling element counts") {
+      list.DisableElementCounts();
+      list.Add(Element::DRAGON_BALL);
+
+      THEN("counts should be computed by scanning") {
+        CHECK_FALSE(list.HasElementCounts());
+        CHECK(list.Count(Element::DRAGON_BALL) ==
+            std::count(elements_ref.begin(), elements_ref.end(), Element::DRAGON_BALL) + 1);
+      }
+    }
+  }
+}
+
+SCENARIO("lazily fill array list capacity") {
+
+  GIVEN("array list in lazy fill mode") {
+    const int init_capacity = GENERATE(1, 5, 100);
+    const int num_elements = GENERATE(0, 3, 250);
+
+    ArrayList list(init_capacity, ArrayList::FillMode::LAZY, GrowthPolicy::Geometric());
+
+    REQUIRE(list.GetFillMode() == ArrayList::FillMode::LAZY);
+
+    vector<Element> elements_ref = utils::generate_elements(num_elements, num_elements);
+    for (const auto e : elements_ref) {
+      list.Add(e);
+    }
+
+    CAPTURE(init_capacity, num_elements);
+
+    WHEN("observing the list") {
+
+      THEN("unused cells should be seen as uninitialized") {
+        elements_ref.resize(list.GetCapacity(), Element::UNINITIALIZED);
+        CHECK(list == elements_ref);
+      }
+    }
+
+    AND_WHEN("reserving capacity and inserting elements") {
+      list.Reserve(list.GetCapacity() + 1000);
+      list.Insert(0, Element::GRAVITY_GUN);
+      elements_ref.insert(elements_ref.begin(), Element::GRAVITY_GUN);
+
+      THEN("elements should be preserved and unused cells should be uninitialized") {
+        CHECK(list.GetSize() == num_elements + 1);
+        elements_ref.resize(list.GetCapacity(), Element::UNINITIALIZED);
+        CHECK(list == elements_ref);
+      }
+    }
+
+    AND_WHEN("removing and clearing elements") {
+      if (num_elements > 0) {
+        list.Remove(0);
+      }
+      list.Clear();
+
+      THEN("all cells should be uninitialized") {
+        CHECK(list.IsEmpty());
+        CHECK(list == vector<Element>(list.GetCapacity(), Element::UNINITIALIZED));
+      }
+    }
+
+    AND_WHEN("cloning the list") {
+      const ArrayList clone = list.Clone();
+
+      THEN("clone should keep the fill mode and elements") {
+        CHECK(clone.GetFillMode() == ArrayList::FillMode::LAZY);
+        elements_ref.resize(clone.GetCapacity(), Element::UNINITIALIZED);
+        CHECK(clone == elements_ref);
+      }
+    }
+  }
+
+  AND_GIVEN("array list in eager fill mode") {
+    ArrayList list(4);
+
+    WHEN("reserving capacity") {
+      list.Add(Element::SECRET_BOX);
+      list.Reserve(8);
+      list.Reserve(2);  // уменьшение емкости не выполняется
+
+      THEN("new cells should be filled immediately") {
+        CHECK(list.GetFillMode() == ArrayList::FillMode::EAGER);
+        CHECK(list.GetCapacity() == 8);
+
+        vector<Element> elements_ref(8, Element::UNINITIALIZED);
+        elements_ref.front() = Element::SECRET_BOX;
+        CHECK(list == elements_ref);
+      }
+    }
+  }
+}
+
+SCENARIO("sort array list elements") {
+
+  GIVEN("array list with random elements") {
+    const int num_elements = GENERATE(0, 1, 7, 300);
+    const bool with_counts = GENERATE(false, true);
+
+    vector<Element> elements_ref = utils::generate_elements(num_elements, num_elements);
+
+    ArrayList list(num_elements + 3);
+    for (const auto e : elements_ref) {
+      list.Add(e);
+    }
+    if (with_counts) list.EnableElementCounts();
+
+    CAPTURE(num_elements, with_counts);
+
+    WHEN("sorting the list") {
+      const bool stable = GENERATE(false, true);
+      if (stable) {
+        list.StableSort();
+      } else {
+        list.Sort();
+      }
+      std::sort(elements_ref.begin(), elements_ref.end());
+
+      THEN("elements should be in ascending order and unused cells should stay uninitialized") {
+        CHECK(list.GetSize() == num_elements);
+        elements_ref.resize(list.GetCapacity(), Element::UNINITIALIZED);
+        CHECK(list == elements_ref);
+      }
+
+      AND_THEN("element counts should not change") {
+        for (int id = 0; id < static_cast<int>(Element::UNINITIALIZED); id++) {
+          const auto e = static_cast<Element>(id);
+          CHECK(list.Count(e) == std::count(elements_ref.begin(), elements_ref.end(), e));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("take copy-on-write snapshots of array list") {
+
+  GIVEN("array list with random elements") {
+    const int num_elements = GENERATE(1, 10, 300);
+    const vector<Element> elements = utils::generate_elements(num_elements, num_elements);
+
+    utils::CountingResource resource;
+    auto list = make_unique<ArrayList>(num_elements, GrowthPolicy::Geometric(), &resource);
+    list->AddRange(elements.data(), num_elements);
+
+    CAPTURE(num_elements);
+
+    WHEN("taking snapshots") {
+      const int num_allocations = resource.num_allocations;
+      const ArrayListSnapshot snapshot = list->Snapshot();
+      const ArrayListSnapshot copy = snapshot;
+      const ArrayListSnapshot another = list->Snapshot();
+
+      THEN("elements should be shared without copying") {
+        CHECK(resource.num_allocations == num_allocations + 1);  // только блок управления
+        CHECK(snapshot == elements);
+        CHECK(copy == elements);
+        CHECK(another == elements);
+        CHECK(snapshot.begin() == another.begin());
+        CHECK(snapshot.Get(num_elements - 1) == elements.back());
+        CHECK_THROWS_AS(snapshot.Get(num_elements), std::out_of_range);
+      }
+
+      AND_WHEN("modifying the list") {
+        const int operation = GENERATE(range(0, 8));
+        vector<Element> elements_ref = elements;
+
+        switch (operation) {
+          case 0:
+            list->Set(0, Element::UNINITIALIZED);
+            elements_ref[0] = Element::UNINITIALIZED;
+            break;
+          case 1:
+            list->Insert(0, Element::GRAVITY_GUN);
+            elements_ref.insert(elements_ref.begin(), Element::GRAVITY_GUN);
+            break;
+          case 2:
+            list->Remove(0);
+            elements_ref.erase(elements_ref.begin());
+            break;
+          case 3:
+            list->Add(Element::SECRET_BOX);  // расширение емкости: буфер освободит последний снимок
+            elements_ref.push_back(Element::SECRET_BOX);
+            break;
+          case 4:
+            list->AddRange(elements.data(), num_elements);
+            elements_ref.insert(elements_ref.end(), elements.begin(), elements.end());
+            break;
+          case 5:
+            list->RemoveRange(0, num_elements);
+            elements_ref.clear();
+            break;
+          case 6:
+            list->Sort();
+            std::sort(elements_ref.begin(), elements_ref.end());
+            break;
+          default:
+            list->Clear();  // новый пустой буфер без копирования стираемых элементов
+            list->Add(Element::CHERRY_PIE);
+            elements_ref = {Element::CHERRY_PIE};
+            break;
+        }
+
+        CAPTURE(operation);
+
+        THEN("snapshots should keep the old elements") {
+          CHECK(snapshot == elements);
+          CHECK(copy == elements);
+          CHECK(another == elements);
+
+          CHECK(list->GetSize() == static_cast<int>(elements_ref.size()));
+          for (int index = 0; index < list->GetSize(); index++) {
+            REQUIRE(list->Get(index) == elements_ref[index]);
+          }
+        }
+
+        AND_WHEN("destroying the list before the snapshots") {
+          list.reset();
+
+          THEN("snapshots should stay readable") {
+            CHECK(snapshot == elements);
+            CHECK(another.Count(elements.front()) == std::count(elements.begin(), elements.end(), elements.front()));
+          }
+        }
+      }
+    }
+
+    AND_WHEN("modifying the list after all snapshots are destroyed") {
+      { const ArrayListSnapshot snapshot = list->Snapshot(); }
+      const int num_allocations = resource.num_allocations;
+      list->Set(0, Element::BEAUTIFUL_FLOWERS);
+      list->Set(num_elements - 1, Element::DRAGON_BALL);
+
+      THEN("buffer should be modified in place") {
+        CHECK(resource.num_allocations == num_allocations);
+        CHECK(list->Get(0) == (num_elements == 1 ? Element::DRAGON_BALL : Element::BEAUTIFUL_FLOWERS));
+      }
+    }
+
+    AND_WHEN("reading snapshots in other threads while the list is modified") {
+      vector<ArrayListSnapshot> snapshots;
+      snapshots.reserve(4);  // потоки читают элементы вектора, он не должен переезжать
+      vector<thread> readers;
+      vector<char> consistent(4, 1);
+
+      for (int reader = 0; reader < 4; reader++) {
+        snapshots.push_back(list->Snapshot());
+        list->Set(reader % num_elements, static_cast<Element>(reader));
+
+        readers.emplace_back([&snapshots, &consistent, reader] {
+          // снимок reader не должен меняться, пока писатель продолжает изменять массив
+          const vector<Element> expected(snapshots[reader].begin(), snapshots[reader].end());
+          for (int pass = 0; pass < 100; pass++) {
+            if (!(snapshots[reader] == expected)) consistent[reader] = 0;
+          }
+        });
+      }
+      for (auto &reader : readers) {
+        reader.join();
+      }
+
+      THEN("every reader should see its snapshot unchanged") {
+        CHECK(std::all_of(consistent.begin(), consistent.end(), [](char c) { return c != 0; }));
+        CHECK(list->Get(3 % num_elements) == Element::GRAVITY_GUN);
+      }
+    }
+  }
+}
+
+SCENARIO("run parallel bulk operations on array list") {
+
+  GIVEN("array list larger than a few parallel parts") {
+    const int num_elements = GENERATE(0, 1000, 3 * ThreadPool::kDefaultGrainSize + 17);
+    const int num_workers = GENERATE(0, 3);
+    const bool with_counts = GENERATE(false, true);
+
+    vector<Element> elements_ref = utils::generate_elements(num_elements, num_elements);
+
+    ArrayList list(std::max(num_elements, 1), GrowthPolicy::Geometric());
+    list.AddRange(elements_ref.data(), num_elements);
+    if (with_counts) list.EnableElementCounts();
+
+    ThreadPool pool(num_workers);
+
+    CAPTURE(num_elements, num_workers, with_counts);
+
+    WHEN("counting and searching elements") {
+
+      THEN("results should match the serial algorithms") {
+        for (int id = 0; id <= static_cast<int>(Element::UNINITIALIZED); id++) {
+          const auto e = static_cast<Element>(id);
+          const auto it = std::find(elements_ref.begin(), elements_ref.end(), e);
+          const int index_ref = it == elements_ref.end() ? ArrayList::kNotFoundElementIndex
+                                                         : static_cast<int>(it - elements_ref.begin());
+          CHECK(list.ParallelIndexOf(e, pool) == index_ref);
+          CHECK(list.ParallelCount(e, pool) == std::count(elements_ref.begin(), elements_ref.end(), e));
+        }
+      }
+    }
+
+    AND_WHEN("searching element present only in the last parts") {
+      if (num_elements > 0) {
+        list.Set(num_elements - 1, Element::UNINITIALIZED);
+        elements_ref.back() = Element::UNINITIALIZED;
+      }
+
+      THEN("its first occurrence should be found") {
+        const int index_ref = num_elements > 0 ? num_elements - 1 : ArrayList::kNotFoundElementIndex;
+        CHECK(list.ParallelIndexOf(Element::UNINITIALIZED, pool) == index_ref);
+      }
+    }
+
+    AND_WHEN("replacing elements") {
+      const ArrayListSnapshot snapshot = list.Snapshot();
+      const int num_replaced = list.ParallelReplace(Element::SECRET_BOX, Element::GRAVITY_GUN, pool);
+      const int num_replaced_ref = static_cast<int>(std::count(elements_ref.begin(), elements_ref.end(), Element::SECRET_BOX));
+      const vector<Element> old_elements = elements_ref;
+      std::replace(elements_ref.begin(), elements_ref.end(), Element::SECRET_BOX, Element::GRAVITY_GUN);
+
+      THEN("all matching elements should be replaced") {
+        CHECK(num_replaced == num_replaced_ref);
+        CHECK(list.Snapshot() == elements_ref);
+        CHECK(list.Count(Element::SECRET_BOX) == 0);
+        CHECK(list.Count(Element::GRAVITY_GUN) == std::count(elements_ref.begin(), elements_ref.end(), Element::GRAVITY_GUN));
+        CHECK(snapshot == old_elements);
+      }
+    }
+
+    AND_WHEN("replacing elements in a buffer that does not start at a cache line") {
+      const int skew = GENERATE(1, 15);  // ячеек от начала кэш-линии до начала буфера
+
+      vector<Element> storage(num_elements + 64);
+      void *aligned = storage.data();
+      std::size_t space = storage.size() * sizeof(Element);
+      std::align(64, sizeof(Element), aligned, space);
+      std::pmr::monotonic_buffer_resource arena(static_cast<Element *>(aligned) + skew,
+                                                (num_elements + 16) * sizeof(Element), std::pmr::null_memory_resource());
+
+      ArrayList skewed(std::max(num_elements, 1), GrowthPolicy::Geometric(), &arena);
+      skewed.AddRange(elements_ref.data(), num_elements);
+      const int num_replaced = skewed.ParallelReplace(Element::SECRET_BOX, Element::GRAVITY_GUN, pool);
+      const int num_replaced_ref = static_cast<int>(std::count(elements_ref.begin(), elements_ref.end(), Element::SECRET_BOX));
+      std::replace(elements_ref.begin(), elements_ref.end(), Element::SECRET_BOX, Element::GRAVITY_GUN);
+
+      THEN("all matching elements should be replaced") {
+        CAPTURE(skew);
+        CHECK(num_replaced == num_replaced_ref);
+        CHECK(skewed.Snapshot() == elements_ref);
+      }
+    }
+
+    AND_WHEN("visiting elements in parallel") {
+      vector<Element> visited(num_elements, Element::UNINITIALIZED);
+      list.ParallelForEach([&visited](int index, Element e) { visited[index] = e; }, pool);
+
+      THEN("every element should be visited with its index") {
+        CHECK(visited == elements_ref);
+      }
+    }
+  }
+}
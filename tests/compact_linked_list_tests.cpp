@@ -0,0 +1,198 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "element.hpp"
+#include "generation.hpp"
+#include "counting_resource.hpp"
+
+#include "compact_linked_list.hpp"
+
+using namespace std;
+using namespace itis;
+using namespace Catch::Matchers;
+
+SCENARIO("create empty compact linked list") {
+
+  WHEN("constructing an empty list") {
+    const CompactLinkedList list;
+
+    THEN("list should have no block") {
+      CHECK(list.IsEmpty());
+      CHECK(list.IsCompact());
+      CHECK(list.GetCapacity() == 0);
+      CHECK(list.head() == Element::UNINITIALIZED);
+      CHECK(list.tail() == Element::UNINITIALIZED);
+      CHECK(list == vector<Element>{});
+    }
+  }
+
+  AND_WHEN("passing null memory resource") {
+
+    THEN("exception should be thrown") {
+      CHECK_THROWS_AS(CompactLinkedList(GrowthPolicy::Geometric(), nullptr), std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("compact linked list behaves like a list") {
+
+  GIVEN("compact linked list and reference vector") {
+    const int num_operations = GENERATE(10, 100, 2000);
+    const auto seed = GENERATE(take(3, random(0u, 100000u)));
+
+    utils::CountingResource resource;
+    CompactLinkedList list(GrowthPolicy::Geometric(), &resource);
+    vector<Element> elements_ref;
+
+    auto engine = mt19937(seed);
+    auto element_dist = uniform_int_distribution<>(0, static_cast<int>(Element::UNINITIALIZED) - 1);
+    auto operation_dist = uniform_int_distribution<>(0, 9);
+
+    WHEN("applying random operations") {
+      for (int operation = 0; operation < num_operations; operation++) {
+        const auto e = static_cast<Element>(element_dist(engine));
+        const int kind = operation_dist(engine);
+        const int size = static_cast<int>(elements_ref.size());
+
+        if (kind < 3 || size == 0) {
+          list.Add(e);
+          elements_ref.push_back(e);
+        } else if (kind < 5) {
+          const int index = uniform_int_distribution<>(0, size)(engine);
+          list.Insert(index, e);
+          elements_ref.insert(elements_ref.begin() + index, e);
+        } else if (kind < 8) {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          REQUIRE(list.Remove(index) == elements_ref.at(index));
+          elements_ref.erase(elements_ref.begin() + index);
+        } else {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          list.Set(index, e);
+          elements_ref.at(index) = e;
+        }
+      }
+
+      CAPTURE(num_operations, seed);
+
+      THEN("elements and slots should match the reference") {
+        REQUIRE(list == elements_ref);
+
+        for (int index = 0; index < list.GetSize(); index++) {
+          REQUIRE(list.Get(index) == elements_ref.at(index));
+        }
+        CHECK(resource.bytes_in_use == static_cast<size_t>(list.GetCapacity()) * CompactLinkedList::kBytesPerNode);
+      }
+
+      AND_THEN("search should match the reference") {
+        for (int id = 0; id < static_cast<int>(Element::UNINITIALIZED); id++) {
+          const auto e = static_cast<Element>(id);
+          const auto it = std::find(elements_ref.begin(), elements_ref.end(), e);
+          const int index_ref = it == elements_ref.end() ? CompactLinkedList::kNotFoundElementIndex
+                                                         : static_cast<int>(it - elements_ref.begin());
+          CHECK(list.IndexOf(e) == index_ref);
+          CHECK(list.Contains(e) == (it != elements_ref.end()));
+          CHECK(list.Count(e) == std::count(elements_ref.begin(), elements_ref.end(), e));
+        }
+      }
+
+      AND_THEN("compacting should keep the elements in list order") {
+        list.Compact();
+        CHECK(list.IsCompact());
+        REQUIRE(list == elements_ref);
+
+        for (int index = 0; index < list.GetSize(); index++) {
+          REQUIRE(list.Get(index) == elements_ref.at(index));
+        }
+      }
+
+      AND_THEN("moved and cloned lists should keep the elements") {
+        CompactLinkedList clone = list.Clone();
+        const CompactLinkedList moved{std::move(list)};
+        CHECK(clone == elements_ref);
+        CHECK(moved == elements_ref);
+        CHECK(list.IsEmpty());
+
+        clone.Add(Element::GRAVITY_GUN);
+        CHECK(moved == elements_ref);
+      }
+
+      AND_THEN("clearing should keep the block") {
+        const int capacity = list.GetCapacity();
+        list.Clear();
+        CHECK(list.IsEmpty());
+        CHECK(list.IsCompact());
+        CHECK(list.GetCapacity() == capacity);
+        CHECK(list == vector<Element>{});
+      }
+    }
+  }
+}
+
+SCENARIO("compact linked list nodes into list order") {
+
+  GIVEN("list built by prepending") {
+    const int num_elements = GENERATE(1, 2, 100);
+    const vector<Element> elements = utils::generate_elements(num_elements, num_elements);
+
+    CompactLinkedList list;
+    vector<Element> elements_ref;
+    for (const auto e : elements) {
+      list.Insert(0, e);
+      elements_ref.insert(elements_ref.begin(), e);
+    }
+
+    THEN("slots should be in reverse list order") {
+      CHECK(list.IsCompact() == (num_elements == 1));
+      CHECK(list == elements_ref);
+    }
+
+    WHEN("compacting the list") {
+      const int capacity = list.GetCapacity();
+      list.Compact();
+
+      THEN("i-th element should be stored in the i-th slot") {
+        CHECK(list.IsCompact());
+        CHECK(list.GetCapacity() == capacity);
+        CHECK(list == elements_ref);
+        CHECK(list.head() == elements_ref.front());
+        CHECK(list.tail() == elements_ref.back());
+      }
+
+      AND_WHEN("appending and removing from the back") {
+        list.Add(Element::SECRET_BOX);
+        list.Remove(list.GetSize() - 1);
+        list.Remove(list.GetSize() - 1);
+        list.Add(Element::DRAGON_BALL);
+        elements_ref.pop_back();
+        elements_ref.push_back(Element::DRAGON_BALL);
+
+        THEN("list should stay compact") {
+          CHECK(list.IsCompact());
+          CHECK(list == elements_ref);
+        }
+      }
+    }
+
+    AND_WHEN("removing and adding elements") {
+      const int capacity = list.GetCapacity();
+      const int num_removed = num_elements / 2;
+      for (int removed = 0; removed < num_removed; removed++) {
+        list.Remove(list.GetSize() / 2);
+        elements_ref.erase(elements_ref.begin() + static_cast<int>(elements_ref.size()) / 2);
+      }
+      for (int added = 0; added < num_removed; added++) {
+        list.Add(Element::BEAUTIFUL_FLOWERS);
+        elements_ref.push_back(Element::BEAUTIFUL_FLOWERS);
+      }
+
+      THEN("freed slots should be reused without growing the block") {
+        CHECK(list.GetCapacity() == capacity);
+        CHECK(list == elements_ref);
+      }
+    }
+  }
+}
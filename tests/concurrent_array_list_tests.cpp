@@ -0,0 +1,182 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "element.hpp"
+#include "generation.hpp"
+#include "counting_resource.hpp"
+
+#include "concurrent_array_list.hpp"
+
+using namespace std;
+using namespace itis;
+using namespace Catch::Matchers;
+
+SCENARIO("create empty concurrent array list") {
+
+  WHEN("constructing an empty list") {
+    const ConcurrentArrayList list;
+
+    THEN("list should have no segments") {
+      CHECK(list.IsEmpty());
+      CHECK(list.GetCapacity() == 0);
+      CHECK(list == vector<Element>{});
+      CHECK_THROWS_AS(list.Get(0), std::out_of_range);
+    }
+  }
+
+  AND_WHEN("passing null memory resource") {
+
+    THEN("exception should be thrown") {
+      CHECK_THROWS_AS(ConcurrentArrayList(nullptr), std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("add elements to concurrent array list from one thread") {
+
+  GIVEN("concurrent array list and random elements") {
+    const int num_elements = GENERATE(1, 64, 65, 1000);
+    const vector<Element> elements_ref = utils::generate_elements(num_elements, num_elements);
+
+    utils::CountingResource resource;
+    ConcurrentArrayList list(&resource);
+
+    CAPTURE(num_elements);
+
+    WHEN("adding elements one by one and as a range") {
+      const int half = num_elements / 2;
+      for (int index = 0; index < half; index++) {
+        list.Add(elements_ref[index]);
+      }
+      list.AddRange(elements_ref.data() + half, num_elements - half);
+
+      THEN("elements should be stored in order") {
+        REQUIRE(list == elements_ref);
+        for (int index = 0; index < num_elements; index++) {
+          REQUIRE(list.Get(index) == elements_ref[index]);
+        }
+        CHECK_THROWS_AS(list.Get(num_elements), std::out_of_range);
+        CHECK(list.GetCapacity() >= num_elements);
+      }
+
+      AND_THEN("elements should be copied to array list") {
+        const ArrayList array_list = list.ToArrayList();
+        CHECK(array_list.GetSize() == num_elements);
+        for (int index = 0; index < num_elements; index++) {
+          REQUIRE(array_list.Get(index) == elements_ref[index]);
+        }
+      }
+
+      AND_THEN("moved and cloned lists should keep the elements") {
+        ConcurrentArrayList clone = list.Clone();
+        const ConcurrentArrayList moved{std::move(list)};
+        CHECK(clone == elements_ref);
+        CHECK(moved == elements_ref);
+        CHECK(list.IsEmpty());
+
+        clone.Add(Element::GRAVITY_GUN);
+        CHECK(moved == elements_ref);
+      }
+
+      AND_THEN("clearing should free all segments") {
+        list.Clear();
+        CHECK(list.IsEmpty());
+        CHECK(list.GetCapacity() == 0);
+        CHECK(resource.bytes_in_use == 0);
+        CHECK(resource.num_deallocations == resource.num_allocations);
+      }
+    }
+
+    AND_WHEN("adding a negative number of elements") {
+
+      THEN("exception should be thrown") {
+        CHECK_THROWS_AS(list.AddRange(elements_ref.data(), -1), std::invalid_argument);
+        CHECK(list.IsEmpty());
+      }
+    }
+
+    AND_WHEN("adding a range that overflows INT_MAX") {
+      list.AddRange(elements_ref.data(), num_elements);
+
+      THEN("exception should be thrown and no cells should be reserved") {
+        // элементы не читаются: размер проверяется до резервирования
+        CHECK_THROWS_AS(list.AddRange(elements_ref.data(), INT_MAX), std::length_error);
+        CHECK(list == elements_ref);
+
+        list.Add(Element::GRAVITY_GUN);
+        CHECK(list.GetSize() == num_elements + 1);
+        CHECK(list.Get(num_elements) == Element::GRAVITY_GUN);
+      }
+    }
+  }
+}
+
+SCENARIO("add elements to concurrent array list from several threads") {
+
+  GIVEN("several producers with their own element values") {
+    const int num_threads = GENERATE(2, 4);
+    const int num_per_thread = GENERATE(100, 3000);
+    const bool add_ranges = GENERATE(false, true);
+
+    ConcurrentArrayList list;
+
+    CAPTURE(num_threads, num_per_thread, add_ranges);
+
+    WHEN("producers append concurrently") {
+      // каждый поток добавляет только свое значение (индекс потока), по одному или диапазонами по 10
+      vector<thread> producers;
+      for (int producer = 0; producer < num_threads; producer++) {
+        producers.emplace_back([&list, producer, num_per_thread, add_ranges] {
+          const auto e = static_cast<Element>(producer);
+          if (add_ranges) {
+            const vector<Element> range(num_per_thread, e);
+            for (int offset = 0; offset < num_per_thread; offset += 10) {
+              list.AddRange(range.data(), std::min(10, num_per_thread - offset));
+            }
+          } else {
+            for (int added = 0; added < num_per_thread; added++) {
+              list.Add(e);
+            }
+          }
+        });
+      }
+      for (auto &producer : producers) {
+        producer.join();
+      }
+
+      THEN("every element should be stored exactly once") {
+        REQUIRE(list.GetSize() == num_threads * num_per_thread);
+        CHECK(list.GetCapacity() >= list.GetSize());
+
+        vector<int> counts(kNumElementValues, 0);
+        for (int index = 0; index < list.GetSize(); index++) {
+          counts[static_cast<int>(list.Get(index))]++;
+        }
+        for (int producer = 0; producer < num_threads; producer++) {
+          CHECK(counts[producer] == num_per_thread);
+        }
+        CHECK(counts[static_cast<int>(Element::UNINITIALIZED)] == 0);
+      }
+
+      AND_THEN("ranges should not interleave") {
+        if (add_ranges) {
+          // диапазон занимает подряд идущие ячейки: серии одинаковых значений состоят из целых диапазонов
+          int run = 1;
+          for (int index = 1; index < list.GetSize(); index++) {
+            if (list.Get(index) == list.Get(index - 1)) {
+              run++;
+            } else {
+              REQUIRE(run % 10 == 0);
+              run = 1;
+            }
+          }
+        }
+      }
+    }
+  }
+}
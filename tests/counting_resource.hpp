@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <memory_resource>
+
+namespace utils {
+
+/**
+ * Источник памяти, подсчитывающий выделения и освобождения памяти.
+ * Память запрашивается у вышестоящего источника (по умолчанию: new/delete).
+ */
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  int num_allocations{0};
+  int num_deallocations{0};
+  std::size_t bytes_in_use{0};
+
+  explicit CountingResource(std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+      : upstream_{upstream} {}
+
+ private:
+  std::pmr::memory_resource *upstream_;
+
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    num_allocations += 1;
+    bytes_in_use += bytes;
+    return upstream_->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override {
+    num_deallocations += 1;
+    bytes_in_use -= bytes;
+    upstream_->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+}  // namespace utils
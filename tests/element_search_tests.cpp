@@ -0,0 +1,66 @@
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+#include "element.hpp"
+#include "generation.hpp"
+
+#include "private/element_search.hpp"
+
+using namespace std;
+using namespace itis;
+using namespace itis::internal;
+
+SCENARIO("vectorized search matches scalar search") {
+
+  GIVEN("search kernel supported by this CPU") {
+    // скалярная реализация сравнивается сама с собой: список не пуст даже без векторных инструкций
+    const auto kernel = GENERATE(filter([](SearchKernel k) { return is_supported(k); },
+                                        values({SearchKernel::SCALAR, SearchKernel::SSE2,
+                                                SearchKernel::AVX2, SearchKernel::AVX512})));
+
+    AND_GIVEN("random elements of various sizes and alignments") {
+      const int size = GENERATE(range(0, 40), 63, 64, 65, 1000, 1001);
+      const int offset = GENERATE(0, 1, 3);  // невыровненное начало блока
+
+      const vector<Element> elements = utils::generate_elements(size + offset, size + offset);
+      const Element *data = elements.data() + offset;
+
+      CAPTURE(static_cast<int>(kernel), size, offset);
+
+      THEN("results should be equal to the scalar kernel for every element") {
+        for (int id = 0; id <= static_cast<int>(Element::UNINITIALIZED); id++) {
+          const auto e = static_cast<Element>(id);
+          CAPTURE(id);
+
+          CHECK(index_of(data, size, e, kernel) == index_of(data, size, e, SearchKernel::SCALAR));
+          CHECK(last_index_of(data, size, e, kernel) == last_index_of(data, size, e, SearchKernel::SCALAR));
+          CHECK(count(data, size, e, kernel) == count(data, size, e, SearchKernel::SCALAR));
+        }
+      }
+    }
+
+    AND_GIVEN("single occurrence at every position") {
+      const int size = 70;
+      const int position = GENERATE_COPY(range(0, size));
+
+      vector<Element> elements(size, Element::SECRET_BOX);
+      elements.at(position) = Element::CHERRY_PIE;
+
+      THEN("occurrence should be found from both ends") {
+        CAPTURE(static_cast<int>(kernel), position);
+        CHECK(index_of(elements.data(), size, Element::CHERRY_PIE, kernel) == position);
+        CHECK(last_index_of(elements.data(), size, Element::CHERRY_PIE, kernel) == position);
+        CHECK(count(elements.data(), size, Element::CHERRY_PIE, kernel) == 1);
+      }
+    }
+  }
+
+  AND_GIVEN("default search kernel") {
+
+    THEN("it should be supported") {
+      CHECK(is_supported(best_search_kernel()));
+      CHECK(is_supported(SearchKernel::SCALAR));
+    }
+  }
+}
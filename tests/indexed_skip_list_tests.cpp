@@ -0,0 +1,158 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "element.hpp"
+#include "generation.hpp"
+#include "counting_resource.hpp"
+
+#include "indexed_skip_list.hpp"
+
+using namespace std;
+using namespace itis;
+using namespace Catch::Matchers;
+
+SCENARIO("create empty indexed skip list") {
+
+  WHEN("constructing an empty list") {
+    const IndexedSkipList list;
+
+    THEN("list should have no elements and a single level") {
+      CHECK(list.IsEmpty());
+      CHECK(list.GetLevel() == 1);
+      CHECK(list.head() == Element::UNINITIALIZED);
+      CHECK(list.tail() == Element::UNINITIALIZED);
+      CHECK(list.IndexOf(Element::CHERRY_PIE) == IndexedSkipList::kNotFoundElementIndex);
+      CHECK(list == vector<Element>{});
+    }
+
+    AND_THEN("access by index should throw") {
+      CHECK_THROWS_AS(list.Get(0), std::out_of_range);
+    }
+  }
+
+  AND_WHEN("passing null memory resource") {
+
+    THEN("exception should be thrown") {
+      CHECK_THROWS_AS(IndexedSkipList(IndexedSkipList::kDefaultSeed, nullptr), std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("indexed skip list behaves like a list") {
+
+  GIVEN("indexed skip list and reference vector") {
+    const int num_operations = GENERATE(10, 100, 2000);
+    const auto seed = GENERATE(take(3, random(0u, 100000u)));
+
+    utils::CountingResource resource;
+    IndexedSkipList list(seed, &resource);
+    vector<Element> elements_ref;
+
+    auto engine = mt19937(seed);
+    auto element_dist = uniform_int_distribution<>(0, static_cast<int>(Element::UNINITIALIZED) - 1);
+    auto operation_dist = uniform_int_distribution<>(0, 9);
+
+    WHEN("applying random operations") {
+      for (int operation = 0; operation < num_operations; operation++) {
+        const auto e = static_cast<Element>(element_dist(engine));
+        const int kind = operation_dist(engine);
+        const int size = static_cast<int>(elements_ref.size());
+
+        if (kind < 3 || size == 0) {
+          list.Add(e);
+          elements_ref.push_back(e);
+        } else if (kind < 5) {
+          const int index = uniform_int_distribution<>(0, size)(engine);
+          list.Insert(index, e);
+          elements_ref.insert(elements_ref.begin() + index, e);
+        } else if (kind < 8) {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          REQUIRE(list.Remove(index) == elements_ref.at(index));
+          elements_ref.erase(elements_ref.begin() + index);
+        } else {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          list.Set(index, e);
+          elements_ref.at(index) = e;
+        }
+      }
+
+      CAPTURE(num_operations, seed);
+
+      THEN("elements and link widths should match the reference") {
+        REQUIRE(list == elements_ref);
+
+        for (int index = 0; index < list.GetSize(); index++) {
+          REQUIRE(list.Get(index) == elements_ref.at(index));
+        }
+      }
+
+      AND_THEN("search should match the reference") {
+        for (int id = 0; id < static_cast<int>(Element::UNINITIALIZED); id++) {
+          const auto e = static_cast<Element>(id);
+          const auto it = std::find(elements_ref.begin(), elements_ref.end(), e);
+          const int index_ref = it == elements_ref.end() ? IndexedSkipList::kNotFoundElementIndex
+                                                         : static_cast<int>(it - elements_ref.begin());
+          CHECK(list.IndexOf(e) == index_ref);
+          CHECK(list.Contains(e) == (it != elements_ref.end()));
+          CHECK(list.Count(e) == std::count(elements_ref.begin(), elements_ref.end(), e));
+        }
+      }
+
+      AND_THEN("moved and cloned lists should keep the elements") {
+        const IndexedSkipList clone = list.Clone();
+        const IndexedSkipList moved{std::move(list)};
+        CHECK(clone == elements_ref);
+        CHECK(moved == elements_ref);
+        CHECK(list.IsEmpty());
+      }
+
+      AND_THEN("clearing should free all nodes except the header") {
+        list.Clear();
+        CHECK(list.IsEmpty());
+        CHECK(list.GetLevel() == 1);
+        CHECK(resource.num_allocations - resource.num_deallocations == 1);
+
+        list.Add(Element::GRAVITY_GUN);
+        CHECK(list == vector<Element>{Element::GRAVITY_GUN});
+      }
+    }
+  }
+}
+
+SCENARIO("reproduce indexed skip list structure with a fixed seed") {
+
+  GIVEN("two lists with the same seed") {
+    const int num_elements = 4096;
+    const auto seed = GENERATE(1u, 42u, 100500u);
+
+    utils::CountingResource resource_lhs;
+    utils::CountingResource resource_rhs;
+    IndexedSkipList lhs(seed, &resource_lhs);
+    IndexedSkipList rhs(seed, &resource_rhs);
+
+    WHEN("applying the same operations") {
+      const vector<Element> elements_ref = utils::generate_elements(num_elements, num_elements);
+      for (int index = 0; index < num_elements; index++) {
+        lhs.Insert(index / 2, elements_ref[index]);
+        rhs.Insert(index / 2, elements_ref[index]);
+      }
+
+      CAPTURE(seed);
+
+      THEN("node levels should be the same") {
+        CHECK(lhs.GetLevel() == rhs.GetLevel());
+        CHECK(resource_lhs.bytes_in_use == resource_rhs.bytes_in_use);
+      }
+
+      AND_THEN("number of levels should be logarithmic") {
+        // log2(4096) = 12
+        CHECK(lhs.GetLevel() >= 6);
+        CHECK(lhs.GetLevel() <= 24);
+      }
+    }
+  }
+}
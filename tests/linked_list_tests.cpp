@@ -1,10 +1,17 @@
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <random>
+#include <thread>
 #include <vector>
 
 #include "element.hpp"
 #include "generation.hpp"
+#include "counting_resource.hpp"
 
 #include "linked_list.hpp"
 
@@ -349,3 +356,935 @@ SCENARIO("find linked list elements") {
     }
   }
 }
+
+SCENARIO("move, swap and clone linked list") {
+
+  GIVEN("non-empty linked list") {
+    const int num_elements = GENERATE(1, 2, 10);
+    const vector<Element> elements_ref = utils::generate_elements(num_elements, num_elements);
+
+    LinkedList list(elements_ref);
+
+    CAPTURE(elements_ref);
+
+    WHEN("moving linked list into a new one") {
+      LinkedList moved_list{std::move(list)};
+
+      THEN("nodes should be transferred") {
+        CHECK(moved_list == elements_ref);
+      }
+
+      AND_THEN("moved-from list should become empty and reusable") {
+        CHECK(list.IsEmpty());
+        CHECK(list.head() == Element::UNINITIALIZED);
+        CHECK(list.tail() == Element::UNINITIALIZED);
+
+        list.Add(Element::CHERRY_PIE);
+        CHECK(list == vector<Element>{Element::CHERRY_PIE});
+      }
+    }
+
+    AND_WHEN("move-assigning linked list") {
+      LinkedList other;
+      other.Add(Element::SECRET_BOX);
+      other = std::move(list);
+
+      THEN("nodes should be transferred") {
+        CHECK(other == elements_ref);
+        CHECK(list.IsEmpty());
+      }
+    }
+
+    AND_WHEN("storing linked lists in a vector") {
+      vector<LinkedList> lists;
+      lists.push_back(std::move(list));
+      lists.emplace_back();
+      lists.emplace_back();
+
+      THEN("nodes should survive reallocation of the vector") {
+        CHECK(lists.front() == elements_ref);
+      }
+    }
+
+    AND_WHEN("swapping linked lists") {
+      LinkedList other;
+      other.Add(Element::GRAVITY_GUN);
+
+      swap(list, other);
+
+      THEN("contents should be exchanged") {
+        CHECK(other == elements_ref);
+        CHECK(list == vector<Element>{Element::GRAVITY_GUN});
+      }
+    }
+
+    AND_WHEN("cloning linked list") {
+      LinkedList clone = list.Clone();
+
+      THEN("clone should have the same elements") {
+        CHECK(clone == elements_ref);
+      }
+
+      AND_THEN("clone should be independent from the original") {
+        clone.Set(0, Element::BEAUTIFUL_FLOWERS);
+        clone.Add(Element::DRAGON_BALL);
+        CHECK(list == elements_ref);
+      }
+    }
+  }
+}
+
+SCENARIO("allocate linked list nodes through a memory resource") {
+
+  GIVEN("counting memory resource") {
+    utils::CountingResource resource;
+
+    WHEN("adding and inserting elements") {
+      const int num_elements = GENERATE(1, 10);
+
+      {
+        LinkedList list(&resource);
+        for (int index = 0; index < num_elements; index++) {
+          list.Add(Element::GRAVITY_GUN);
+        }
+        list.Insert(0, Element::CHERRY_PIE);
+        list.Insert(1, Element::CHERRY_PIE);
+
+        THEN("every node should be allocated through the resource") {
+          CHECK(list.GetMemoryResource() == &resource);
+          CHECK(resource.num_allocations == num_elements + 2);
+          CHECK(resource.bytes_in_use == (num_elements + 2) * sizeof(Node));
+        }
+
+        AND_THEN("clone should use the same resource") {
+          const LinkedList clone = list.Clone();
+          CHECK(clone.GetMemoryResource() == &resource);
+          CHECK(resource.num_allocations == 2 * (num_elements + 2));
+        }
+      }
+
+      AND_THEN("all nodes should be returned to the resource") {
+        CHECK(resource.num_allocations == resource.num_deallocations);
+        CHECK(resource.bytes_in_use == 0);
+      }
+    }
+  }
+
+  AND_GIVEN("monotonic buffer resource") {
+    std::pmr::monotonic_buffer_resource arena;
+    utils::CountingResource heap;
+
+    std::pmr::memory_resource *const previous = std::pmr::set_default_resource(&heap);
+
+    WHEN("adding and clearing elements") {
+      LinkedList list(&arena);
+      for (int index = 0; index < 1000; index++) {
+        list.Add(Element::DRAGON_BALL);
+      }
+      list.Clear();
+
+      THEN("global heap should not be touched") {
+        CHECK(list.IsEmpty());
+        CHECK(heap.num_allocations == 0);
+      }
+    }
+
+    std::pmr::set_default_resource(previous);
+  }
+
+  AND_GIVEN("null memory resource") {
+
+    THEN("exception should be thrown") {
+      CHECK_THROWS_AS(LinkedList(nullptr), std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("maintain element counts of the linked list") {
+
+  GIVEN("linked list with enabled element counts") {
+    const int init_num_elements = GENERATE(1, 15);
+    vector<Element> elements_ref = utils::generate_elements(init_num_elements, init_num_elements);
+
+    LinkedList list(elements_ref);
+    list.EnableElementCounts();
+
+    REQUIRE(list.HasElementCounts());
+
+    WHEN("mutating the list") {
+      list.Add(Element::CHERRY_PIE);
+      list.Insert(0, Element::SECRET_BOX);
+      list.Insert(1, Element::SECRET_BOX);
+      list.Set(1, Element::GRAVITY_GUN);
+      list.Remove(0);
+      list.Remove(list.GetSize() - 1);
+      list.Remove(list.GetSize() / 2);
+
+      elements_ref.push_back(Element::CHERRY_PIE);
+      elements_ref.insert(elements_ref.begin(), Element::SECRET_BOX);
+      elements_ref.insert(elements_ref.begin() + 1, Element::SECRET_BOX);
+      elements_ref.at(1) = Element::GRAVITY_GUN;
+      elements_ref.erase(elements_ref.begin());
+      elements_ref.pop_back();
+      elements_ref.erase(elements_ref.begin() + elements_ref.size() / 2);
+
+      THEN("list should match the reference") {
+        CHECK(list == elements_ref);
+      }
+
+      AND_THEN("counts should match the number of occurrences") {
+        for (int id = 0; id < kNumElementValues; id++) {
+          const auto e = static_cast<Element>(id);
+          const auto count_ref = static_cast<int>(std::count(elements_ref.begin(), elements_ref.end(), e));
+
+          CAPTURE(id);
+          CHECK(list.Count(e) == count_ref);
+          CHECK(list.Contains(e) == (count_ref > 0));
+
+          if (count_ref == 0) {
+            CHECK(list.IndexOf(e) == LinkedList::kNotFoundElementIndex);
+          }
+        }
+      }
+
+      AND_THEN("counts should survive clone") {
+        const LinkedList clone = list.Clone();
+        CHECK(clone.HasElementCounts());
+        CHECK(clone.Count(Element::GRAVITY_GUN) == list.Count(Element::GRAVITY_GUN));
+      }
+    }
+
+    AND_WHEN("disabling element counts") {
+      list.DisableElementCounts();
+
+      THEN("counts and membership should be computed by scanning") {
+        for (int id = 0; id < kNumElementValues; id++) {
+          const auto e = static_cast<Element>(id);
+          const auto count_ref = static_cast<int>(std::count(elements_ref.begin(), elements_ref.end(), e));
+
+          CHECK(list.Count(e) == count_ref);
+          CHECK(list.Contains(e) == (count_ref > 0));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("allocate linked list nodes from a node pool") {
+
+  GIVEN("counting memory resource and pooled linked list") {
+    utils::CountingResource resource;
+
+    WHEN("adding more nodes than fit in one slab") {
+      const int num_elements = LinkedList::kNodesPerSlab + 1;
+
+      {
+        LinkedList list(LinkedList::NodeAllocation::POOL, &resource);
+        REQUIRE(list.GetNodeAllocation() == LinkedList::NodeAllocation::POOL);
+
+        vector<Element> elements_ref;
+        for (int index = 0; index < num_elements; index++) {
+          const auto e = static_cast<Element>(index % 5);
+          list.Add(e);
+          elements_ref.push_back(e);
+        }
+
+        THEN("nodes should be carved out of two slabs") {
+          const NodePoolStats stats = list.GetNodePoolStats();
+          CHECK(list == elements_ref);
+          CHECK(resource.num_allocations == 2);
+          CHECK(stats.num_slabs == 2);
+          CHECK(stats.num_nodes_in_use == num_elements);
+          CHECK(stats.num_free_nodes == 2 * LinkedList::kNodesPerSlab - num_elements);
+          CHECK(stats.bytes_reserved == static_cast<long long>(resource.bytes_in_use));
+        }
+
+        AND_WHEN("removing and adding elements again") {
+          for (int index = 0; index < 10; index++) {
+            list.Remove(index);
+            list.Insert(index, Element::SECRET_BOX);
+            elements_ref.at(index) = Element::SECRET_BOX;
+          }
+
+          THEN("removed nodes should be reused without new slabs") {
+            CHECK(list == elements_ref);
+            CHECK(resource.num_allocations == 2);
+            CHECK(resource.num_deallocations == 0);
+            CHECK(list.GetNodePoolStats().num_nodes_in_use == num_elements);
+          }
+        }
+
+        AND_WHEN("clearing the list") {
+          list.Clear();
+
+          THEN("all slabs should be returned at once") {
+            CHECK(list.IsEmpty());
+            CHECK(resource.num_deallocations == 2);
+            CHECK(resource.bytes_in_use == 0);
+            CHECK(list.GetNodePoolStats().num_slabs == 0);
+          }
+
+          AND_THEN("list should still be usable") {
+            list.Add(Element::DRAGON_BALL);
+            CHECK(list == vector<Element>{Element::DRAGON_BALL});
+            CHECK(list.GetNodePoolStats().num_slabs == 1);
+          }
+        }
+
+        AND_WHEN("moving and cloning the list") {
+          LinkedList moved{std::move(list)};
+          const LinkedList clone = moved.Clone();
+
+          THEN("slabs should move along with the nodes") {
+            CHECK(moved == elements_ref);
+            CHECK(clone == elements_ref);
+            CHECK(moved.GetNodePoolStats().num_slabs == 2);
+            CHECK(list.GetNodePoolStats().num_slabs == 0);
+            CHECK(clone.GetNodeAllocation() == LinkedList::NodeAllocation::POOL);
+            CHECK(list.GetNodeAllocation() == LinkedList::NodeAllocation::POOL);
+          }
+        }
+      }
+
+      AND_THEN("all slabs should be returned to the resource") {
+        CHECK(resource.num_allocations == resource.num_deallocations);
+        CHECK(resource.bytes_in_use == 0);
+      }
+    }
+  }
+
+  AND_GIVEN("heap allocated linked list") {
+    LinkedList list;
+    list.Add(Element::CHERRY_PIE);
+
+    THEN("pool statistics should be empty") {
+      CHECK(list.GetNodeAllocation() == LinkedList::NodeAllocation::HEAP);
+      CHECK(list.GetNodePoolStats().num_slabs == 0);
+      CHECK(list.GetNodePoolStats().num_nodes_in_use == 0);
+    }
+  }
+}
+
+SCENARIO("traverse doubly linked list from both ends") {
+
+  GIVEN("linked list") {
+    const int num_elements = GENERATE(1, 2, 15);
+    vector<Element> elements_ref = utils::generate_elements(num_elements, num_elements);
+
+    LinkedList list(elements_ref);
+
+    WHEN("getting every element") {
+
+      THEN("elements near both ends should be found") {
+        for (int index = 0; index < num_elements; index++) {
+          CHECK(list.Get(index) == elements_ref.at(index));
+        }
+      }
+    }
+
+    AND_WHEN("removing elements from the back") {
+      while (!list.IsEmpty()) {
+        REQUIRE(list.Remove(list.GetSize() - 1) == elements_ref.back());
+        elements_ref.pop_back();
+
+        REQUIRE(list == elements_ref);
+        REQUIRE(list.tail() == (elements_ref.empty() ? Element::UNINITIALIZED : elements_ref.back()));
+      }
+
+      THEN("list should become empty") {
+        CHECK(list.head() == Element::UNINITIALIZED);
+        CHECK(list.tail() == Element::UNINITIALIZED);
+      }
+    }
+  }
+
+  AND_GIVEN("linked list under random operations") {
+    const auto allocation = GENERATE(LinkedList::NodeAllocation::HEAP, LinkedList::NodeAllocation::POOL);
+    const auto seed = GENERATE(take(3, random(0u, 100000u)));
+
+    LinkedList list(allocation);
+    vector<Element> elements_ref;
+
+    auto engine = mt19937(seed);
+    auto element_dist = uniform_int_distribution<>(0, static_cast<int>(Element::UNINITIALIZED) - 1);
+    auto operation_dist = uniform_int_distribution<>(0, 9);
+
+    WHEN("applying random operations") {
+      for (int operation = 0; operation < 500; operation++) {
+        const auto e = static_cast<Element>(element_dist(engine));
+        const int kind = operation_dist(engine);
+        const int size = static_cast<int>(elements_ref.size());
+
+        if (kind < 3 || size == 0) {
+          list.Add(e);
+          elements_ref.push_back(e);
+        } else if (kind < 5) {
+          const int index = uniform_int_distribution<>(0, size)(engine);
+          list.Insert(index, e);
+          elements_ref.insert(elements_ref.begin() + index, e);
+        } else if (kind < 8) {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          REQUIRE(list.Remove(index) == elements_ref.at(index));
+          elements_ref.erase(elements_ref.begin() + index);
+        } else {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          list.Set(index, e);
+          elements_ref.at(index) = e;
+        }
+      }
+
+      THEN("forward and backward links should match the reference") {
+        CAPTURE(seed);
+        CHECK(list == elements_ref);
+      }
+    }
+  }
+}
+
+SCENARIO("iterate over linked list") {
+
+  GIVEN("linked list") {
+    const int num_elements = GENERATE(0, 1, 15);
+    const vector<Element> elements_ref = utils::generate_elements(num_elements, num_elements);
+
+    LinkedList list;
+    for (const auto e : elements_ref) {
+      list.Add(e);
+    }
+
+    WHEN("using range-based for") {
+      vector<Element> elements;
+      for (const Element e : list) {
+        elements.push_back(e);
+      }
+
+      THEN("all elements should be visited in order") {
+        CHECK(elements == elements_ref);
+      }
+    }
+
+    AND_WHEN("using STL algorithms") {
+
+      THEN("results should match the reference") {
+        CHECK(vector<Element>(list.begin(), list.end()) == elements_ref);
+        CHECK(std::distance(list.begin(), list.end()) == num_elements);
+        CHECK(std::count(list.begin(), list.end(), Element::CHERRY_PIE) ==
+            std::count(elements_ref.begin(), elements_ref.end(), Element::CHERRY_PIE));
+
+        vector<Element> reversed(std::make_reverse_iterator(list.end()), std::make_reverse_iterator(list.begin()));
+        CHECK(reversed == vector<Element>(elements_ref.rbegin(), elements_ref.rend()));
+      }
+    }
+  }
+}
+
+SCENARIO("edit linked list through a cursor") {
+
+  GIVEN("linked list with element counts") {
+    vector<Element> elements_ref{Element::CHERRY_PIE, Element::SECRET_BOX, Element::SECRET_BOX,
+                                 Element::DRAGON_BALL, Element::SECRET_BOX};
+
+    LinkedList list(elements_ref);
+    list.EnableElementCounts();
+
+    WHEN("filtering elements in one pass") {
+      auto cursor = list.BeforeBegin();
+      while (cursor.HasNext()) {
+        if (cursor.GetNext() == Element::SECRET_BOX) {
+          cursor.EraseAfter();
+        } else {
+          cursor.Next();
+        }
+      }
+
+      THEN("matching elements should be erased") {
+        CHECK(list == vector<Element>{Element::CHERRY_PIE, Element::DRAGON_BALL});
+        CHECK(list.Count(Element::SECRET_BOX) == 0);
+        CHECK(list.tail() == Element::DRAGON_BALL);
+      }
+    }
+
+    AND_WHEN("inserting after and setting elements") {
+      auto cursor = list.CursorAt(1);
+      cursor.InsertAfter(Element::GRAVITY_GUN);
+      cursor.Set(Element::BEAUTIFUL_FLOWERS);
+
+      auto before_begin = list.BeforeBegin();
+      before_begin.InsertAfter(Element::DRAGON_BALL);
+
+      auto last = list.CursorAt(list.GetSize() - 1);
+      last.InsertAfter(Element::CHERRY_PIE);
+
+      elements_ref.insert(elements_ref.begin() + 2, Element::GRAVITY_GUN);
+      elements_ref.at(1) = Element::BEAUTIFUL_FLOWERS;
+      elements_ref.insert(elements_ref.begin(), Element::DRAGON_BALL);
+      elements_ref.push_back(Element::CHERRY_PIE);
+
+      THEN("list and counts should match the reference") {
+        CHECK(list == elements_ref);
+        CHECK(cursor.Get() == Element::BEAUTIFUL_FLOWERS);
+        CHECK(cursor.GetNext() == Element::GRAVITY_GUN);
+        CHECK(list.Count(Element::BEAUTIFUL_FLOWERS) == 1);
+        CHECK(list.Count(Element::CHERRY_PIE) == 2);
+        CHECK(list.head() == Element::DRAGON_BALL);
+        CHECK(list.tail() == Element::CHERRY_PIE);
+      }
+    }
+
+    AND_WHEN("using cursor at invalid positions") {
+      auto before_begin = list.BeforeBegin();
+      auto last = list.CursorAt(list.GetSize() - 1);
+
+      THEN("exception should be thrown") {
+        CHECK_FALSE(before_begin.IsValid());
+        CHECK_THROWS_AS(before_begin.Get(), std::out_of_range);
+        CHECK_THROWS_AS(before_begin.Set(Element::CHERRY_PIE), std::out_of_range);
+        CHECK_FALSE(last.HasNext());
+        CHECK_THROWS_AS(last.Next(), std::out_of_range);
+        CHECK_THROWS_AS(last.EraseAfter(), std::out_of_range);
+        CHECK_THROWS_AS(list.CursorAt(list.GetSize()), std::out_of_range);
+      }
+    }
+  }
+}
+
+SCENARIO("reuse linked list finger for sequential access") {
+
+  GIVEN("linked list") {
+    const int num_elements = GENERATE(1, 2, 40);
+    vector<Element> elements_ref = utils::generate_elements(num_elements, num_elements);
+
+    LinkedList list(elements_ref);
+
+    WHEN("getting and setting elements sequentially in both directions") {
+      for (int index = 0; index < num_elements; index++) {
+        REQUIRE(list.Get(index) == elements_ref.at(index));
+      }
+      for (int index = num_elements - 1; index >= 0; index--) {
+        list.Set(index, Element::GRAVITY_GUN);
+        elements_ref.at(index) = Element::GRAVITY_GUN;
+      }
+
+      THEN("list should match the reference") {
+        CHECK(list == elements_ref);
+      }
+    }
+
+    AND_WHEN("removing every other element front to back") {
+      for (int index = 0; index < list.GetSize(); index++) {
+        REQUIRE(list.Remove(index) == elements_ref.at(index));
+        elements_ref.erase(elements_ref.begin() + index);
+        REQUIRE(list == elements_ref);
+      }
+
+      THEN("list should match the reference") {
+        CHECK(list.GetSize() == num_elements / 2);
+        CHECK(list == elements_ref);
+      }
+    }
+  }
+
+  AND_GIVEN("linked list under random indexed and cursor operations") {
+    const auto seed = GENERATE(take(3, random(0u, 100000u)));
+
+    LinkedList list;
+    vector<Element> elements_ref;
+
+    auto engine = mt19937(seed);
+    auto element_dist = uniform_int_distribution<>(0, static_cast<int>(Element::UNINITIALIZED) - 1);
+    auto operation_dist = uniform_int_distribution<>(0, 9);
+
+    WHEN("applying random operations") {
+      for (int operation = 0; operation < 300; operation++) {
+        const auto e = static_cast<Element>(element_dist(engine));
+        const int kind = operation_dist(engine);
+        const int size = static_cast<int>(elements_ref.size());
+
+        if (kind < 2 || size == 0) {
+          list.Add(e);
+          elements_ref.push_back(e);
+        } else if (kind < 4) {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          REQUIRE(list.Get(index) == elements_ref.at(index));
+        } else if (kind < 5) {
+          const int index = uniform_int_distribution<>(0, size)(engine);
+          list.Insert(index, e);
+          elements_ref.insert(elements_ref.begin() + index, e);
+        } else if (kind < 6) {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          REQUIRE(list.Remove(index) == elements_ref.at(index));
+          elements_ref.erase(elements_ref.begin() + index);
+        } else if (kind < 7) {
+          // вставка и удаление в начале списка через курсор
+          list.BeforeBegin().InsertAfter(e);
+          elements_ref.insert(elements_ref.begin(), e);
+          if (operation % 2 == 0) {
+            REQUIRE(list.BeforeBegin().EraseAfter() == elements_ref.front());
+            elements_ref.erase(elements_ref.begin());
+          }
+        } else if (kind < 8) {
+          // вставка через курсор в произвольной позиции (палец может оказаться до или после нее)
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          list.CursorAt(index).InsertAfter(e);
+          elements_ref.insert(elements_ref.begin() + index + 1, e);
+          list.Get(uniform_int_distribution<>(0, size)(engine));
+        } else if (size > 1) {
+          // удаление через курсор в произвольной позиции
+          const int index = uniform_int_distribution<>(0, size - 2)(engine);
+          auto cursor = list.CursorAt(index);
+          list.Get(uniform_int_distribution<>(0, size - 1)(engine));
+          REQUIRE(cursor.EraseAfter() == elements_ref.at(index + 1));
+          elements_ref.erase(elements_ref.begin() + index + 1);
+        }
+
+        CAPTURE(seed, operation);
+        REQUIRE(list == elements_ref);
+      }
+
+      THEN("elements should be accessible by index") {
+        for (int index = 0; index < static_cast<int>(elements_ref.size()); index++) {
+          REQUIRE(list.Get(index) == elements_ref.at(index));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("read linked list from several threads") {
+
+  GIVEN("linked list shared between readers") {
+    const int num_elements = 500;
+    const vector<Element> elements_ref = utils::generate_elements(num_elements, num_elements);
+    const LinkedList list(elements_ref);
+
+    WHEN("readers get elements by index concurrently") {
+      // каждый поток обходит список со своим шагом: пальцы потоков постоянно перезаписывают друг друга
+      vector<int> num_mismatches(4, 0);
+      vector<thread> readers;
+      for (int reader = 0; reader < 4; reader++) {
+        readers.emplace_back([&, reader] {
+          for (int round = 0; round < 20; round++) {
+            for (int index = reader; index < num_elements; index += reader + 1) {
+              if (list.Get(index) != elements_ref[index]) num_mismatches[reader]++;
+            }
+          }
+        });
+      }
+      for (auto &reader : readers) {
+        reader.join();
+      }
+
+      THEN("every reader should see the right elements") {
+        CHECK(num_mismatches == vector<int>(4, 0));
+        CHECK(list == elements_ref);
+      }
+    }
+  }
+}
+
+SCENARIO("splice and split linked lists") {
+
+  GIVEN("two lists sharing a memory resource") {
+    utils::CountingResource resource;
+
+    const vector<Element> lhs_ref{Element::CHERRY_PIE, Element::SECRET_BOX, Element::DRAGON_BALL};
+    const vector<Element> rhs_ref{Element::GRAVITY_GUN, Element::BEAUTIFUL_FLOWERS};
+
+    LinkedList lhs(&resource);
+    LinkedList rhs(&resource);
+    for (const auto e : lhs_ref) lhs.Add(e);
+    for (const auto e : rhs_ref) rhs.Add(e);
+    lhs.EnableElementCounts();
+
+    const int num_allocations = resource.num_allocations;
+
+    WHEN("splicing at any position") {
+      const int index = GENERATE(0, 1, 3);
+      lhs.Get(1);  // палец перед местом вставки или после него
+      lhs.SpliceAt(index, std::move(rhs));
+
+      vector<Element> elements_ref = lhs_ref;
+      elements_ref.insert(elements_ref.begin() + index, rhs_ref.begin(), rhs_ref.end());
+
+      THEN("nodes should be relinked without allocations") {
+        CAPTURE(index);
+        CHECK(lhs == elements_ref);
+        CHECK(rhs == vector<Element>{});
+        CHECK(rhs.IsEmpty());
+        CHECK(resource.num_allocations == num_allocations);
+        CHECK(lhs.Count(Element::GRAVITY_GUN) == 1);
+        CHECK(lhs.Count(Element::CHERRY_PIE) == 1);
+      }
+
+      AND_THEN("both lists should stay usable") {
+        rhs.Add(Element::SECRET_BOX);
+        lhs.Remove(lhs.GetSize() - 1);
+        elements_ref.pop_back();
+        CHECK(rhs == vector<Element>{Element::SECRET_BOX});
+        CHECK(lhs == elements_ref);
+      }
+    }
+
+    AND_WHEN("appending the list to the end") {
+      lhs.Splice(std::move(rhs));
+
+      THEN("elements should be concatenated") {
+        CHECK(lhs == vector<Element>{Element::CHERRY_PIE, Element::SECRET_BOX, Element::DRAGON_BALL,
+                                     Element::GRAVITY_GUN, Element::BEAUTIFUL_FLOWERS});
+        CHECK(lhs.tail() == Element::BEAUTIFUL_FLOWERS);
+        CHECK(resource.num_allocations == num_allocations);
+      }
+    }
+
+    AND_WHEN("splitting at any position") {
+      const int index = GENERATE(0, 1, 2, 3);
+      LinkedList suffix = lhs.SplitAt(index);
+
+      THEN("suffix nodes should move to the new list") {
+        CAPTURE(index);
+        CHECK(lhs == vector<Element>(lhs_ref.begin(), lhs_ref.begin() + index));
+        CHECK(suffix == vector<Element>(lhs_ref.begin() + index, lhs_ref.end()));
+        CHECK(suffix.GetMemoryResource() == &resource);
+        CHECK(resource.num_allocations == num_allocations);
+        CHECK(suffix.HasElementCounts());
+        CHECK(lhs.Count(Element::SECRET_BOX) + suffix.Count(Element::SECRET_BOX) == 1);
+        CHECK(suffix.Count(Element::DRAGON_BALL) == (index <= 2 ? 1 : 0));
+      }
+
+      AND_WHEN("splicing the suffix back") {
+        lhs.Splice(std::move(suffix));
+
+        THEN("original list should be restored") {
+          CHECK(lhs == lhs_ref);
+          CHECK(lhs.Count(Element::DRAGON_BALL) == 1);
+        }
+      }
+    }
+
+    AND_WHEN("splicing the list into itself") {
+
+      THEN("exception should be thrown") {
+        CHECK_THROWS_AS(lhs.Splice(std::move(lhs)), std::invalid_argument);
+        CHECK_THROWS_AS(lhs.SpliceAt(4, std::move(rhs)), std::out_of_range);
+        CHECK_THROWS_AS(lhs.SplitAt(-1), std::out_of_range);
+      }
+    }
+  }
+
+  AND_GIVEN("lists with incompatible node storage") {
+    utils::CountingResource resource;
+
+    LinkedList lhs(LinkedList::NodeAllocation::POOL, &resource);
+    LinkedList rhs(vector<Element>{Element::GRAVITY_GUN, Element::SECRET_BOX});
+    lhs.Add(Element::CHERRY_PIE);
+
+    WHEN("splicing a heap allocated list into a pooled list") {
+      lhs.SpliceAt(0, std::move(rhs));
+
+      THEN("elements should be copied into the pool") {
+        CHECK(lhs == vector<Element>{Element::GRAVITY_GUN, Element::SECRET_BOX, Element::CHERRY_PIE});
+        CHECK(rhs.IsEmpty());
+        CHECK(lhs.GetNodePoolStats().num_nodes_in_use == 3);
+      }
+    }
+  }
+
+  AND_GIVEN("two pooled lists") {
+    utils::CountingResource resource;
+
+    {
+      LinkedList lhs(LinkedList::NodeAllocation::POOL, &resource);
+      LinkedList rhs(LinkedList::NodeAllocation::POOL, &resource);
+
+      vector<Element> elements_ref;
+      for (int index = 0; index < LinkedList::kNodesPerSlab + 10; index++) {
+        const auto e = static_cast<Element>(index % 5);
+        (index % 2 == 0 ? lhs : rhs).Add(e);
+      }
+      rhs.Remove(0);
+
+      WHEN("splicing one into another") {
+        const int lhs_size = lhs.GetSize();
+        const int rhs_size = rhs.GetSize();
+        lhs.Splice(std::move(rhs));
+
+        THEN("slabs should move along with the nodes") {
+          const NodePoolStats stats = lhs.GetNodePoolStats();
+          CHECK(lhs.GetSize() == lhs_size + rhs_size);
+          CHECK(stats.num_slabs == 2);
+          CHECK(stats.num_nodes_in_use == lhs_size + rhs_size);
+          CHECK(stats.num_free_nodes == 2 * LinkedList::kNodesPerSlab - lhs_size - rhs_size);
+          CHECK(rhs.GetNodePoolStats().num_slabs == 0);
+        }
+
+        AND_WHEN("filling the free cells of both slabs and splicing again") {
+          const int num_free = lhs.GetNodePoolStats().num_free_nodes;
+          for (int index = 0; index < num_free; index++) {
+            lhs.Add(Element::DRAGON_BALL);
+          }
+          const int num_allocations = resource.num_allocations;
+
+          LinkedList other(LinkedList::NodeAllocation::POOL, &resource);
+          other.Add(Element::SECRET_BOX);
+          other.Add(Element::GRAVITY_GUN);
+          other.Remove(0);
+          lhs.Splice(std::move(other));
+          lhs.Add(Element::CHERRY_PIE);
+          lhs.Add(Element::CHERRY_PIE);
+
+          THEN("free nodes and unused cells of merged slabs should be reused") {
+            const NodePoolStats stats = lhs.GetNodePoolStats();
+            CHECK(num_allocations == 2);
+            CHECK(resource.num_allocations == 3);
+            CHECK(stats.num_slabs == 3);
+            CHECK(stats.num_nodes_in_use == lhs.GetSize());
+            CHECK(stats.num_free_nodes == 3 * LinkedList::kNodesPerSlab - lhs.GetSize());
+            CHECK(lhs.Get(lhs.GetSize() - 3) == Element::GRAVITY_GUN);
+          }
+        }
+
+        AND_WHEN("splitting the result") {
+          LinkedList suffix = lhs.SplitAt(lhs_size);
+
+          THEN("suffix should be copied into its own pool") {
+            CHECK(lhs.GetSize() == lhs_size);
+            CHECK(suffix.GetSize() == rhs_size);
+            CHECK(suffix.GetNodeAllocation() == LinkedList::NodeAllocation::POOL);
+            CHECK(lhs.GetNodePoolStats().num_nodes_in_use == lhs_size);
+          }
+        }
+      }
+    }
+
+    THEN("all slabs should be returned to the resource") {
+      CHECK(resource.num_allocations == resource.num_deallocations);
+      CHECK(resource.bytes_in_use == 0);
+    }
+  }
+}
+
+SCENARIO("sort linked list elements") {
+
+  GIVEN("linked list with random elements") {
+    const int num_elements = GENERATE(1, 2, 7, 300);
+    const bool with_counts = GENERATE(false, true);
+
+    vector<Element> elements_ref = utils::generate_elements(num_elements, num_elements);
+
+    LinkedList list(elements_ref);
+    if (with_counts) list.EnableElementCounts();
+    list.Get(num_elements / 2);  // установка пальца
+
+    CAPTURE(num_elements, with_counts);
+
+    WHEN("sorting the list") {
+      const bool stable = GENERATE(false, true);
+      if (stable) {
+        list.StableSort();
+      } else {
+        list.Sort();
+      }
+      std::sort(elements_ref.begin(), elements_ref.end());
+
+      THEN("elements should be in ascending order") {
+        CHECK(list == elements_ref);
+        CHECK(list.head() == elements_ref.front());
+        CHECK(list.tail() == elements_ref.back());
+
+        for (int index = 0; index < num_elements; index++) {
+          REQUIRE(list.Get(index) == elements_ref.at(index));
+        }
+      }
+
+      AND_THEN("element counts should not change") {
+        for (int id = 0; id < static_cast<int>(Element::UNINITIALIZED); id++) {
+          const auto e = static_cast<Element>(id);
+          CHECK(list.Count(e) == std::count(elements_ref.begin(), elements_ref.end(), e));
+        }
+      }
+    }
+  }
+
+  AND_GIVEN("linked list with equal elements and cursors on them") {
+    LinkedList list(vector<Element>{Element::SECRET_BOX, Element::CHERRY_PIE, Element::SECRET_BOX,
+                                    Element::DRAGON_BALL});
+    auto first = list.CursorAt(0);
+    auto second = list.CursorAt(2);
+
+    WHEN("sorting the list") {
+      const bool stable = GENERATE(false, true);
+      if (stable) {
+        list.StableSort();
+      } else {
+        list.Sort();
+      }
+
+      THEN("nodes with equal values should keep their order") {
+        CHECK(list == vector<Element>{Element::CHERRY_PIE, Element::SECRET_BOX, Element::SECRET_BOX,
+                                      Element::DRAGON_BALL});
+        CHECK(first.Get() == Element::SECRET_BOX);
+        CHECK(second.Get() == Element::SECRET_BOX);
+        CHECK(second.GetNext() == Element::DRAGON_BALL);
+
+        first.Next();
+        CHECK(first.GetNext() == Element::DRAGON_BALL);
+      }
+    }
+  }
+}
+
+SCENARIO("visit linked list elements from both ends") {
+
+  GIVEN("linked list with random elements") {
+    const int num_elements = GENERATE(0, 1, 2, 3, 8, 301);
+    const vector<Element> elements_ref = utils::generate_elements(num_elements, num_elements);
+
+    utils::CountingResource resource;
+    LinkedList list(&resource);
+    for (const auto e : elements_ref) {
+      list.Add(e);
+    }
+
+    CAPTURE(num_elements);
+
+    WHEN("visiting every element") {
+      vector<Element> visited(num_elements, Element::UNINITIALIZED);
+      vector<int> num_visits(num_elements, 0);
+
+      list.ForEach([&](int index, Element e) {
+        visited.at(index) = e;
+        num_visits.at(index)++;
+      });
+
+      THEN("each element should be visited exactly once with its index") {
+        CHECK(visited == elements_ref);
+        CHECK(std::all_of(num_visits.begin(), num_visits.end(), [](int n) { return n == 1; }));
+      }
+    }
+
+    AND_WHEN("searching for elements") {
+
+      THEN("first occurrences and counts should match the reference") {
+        for (int id = 0; id <= static_cast<int>(Element::UNINITIALIZED); id++) {
+          const auto e = static_cast<Element>(id);
+          const auto it = std::find(elements_ref.begin(), elements_ref.end(), e);
+          const int index_ref = it == elements_ref.end() ? LinkedList::kNotFoundElementIndex
+                                                         : static_cast<int>(it - elements_ref.begin());
+          CHECK(list.IndexOf(e) == index_ref);
+          CHECK(list.Contains(e) == (it != elements_ref.end()));
+          CHECK(list.Count(e) == std::count(elements_ref.begin(), elements_ref.end(), e));
+        }
+      }
+    }
+
+    AND_WHEN("clearing the list") {
+      list.Clear();
+
+      THEN("all nodes should be freed") {
+        CHECK(list.IsEmpty());
+        CHECK(resource.num_deallocations == resource.num_allocations);
+        CHECK(resource.bytes_in_use == 0);
+      }
+    }
+  }
+}
@@ -0,0 +1,67 @@
+#include <catch2/catch.hpp>
+
+#include <stdexcept>
+
+#include "array_list.hpp"
+#include "growth_policy.hpp"
+#include "linked_list.hpp"
+#include "operation_stats.hpp"
+
+using namespace std;
+using namespace itis;
+
+SCENARIO("count container operations") {
+
+  GIVEN("reset counters") {
+    ResetStats();
+
+    WHEN("growing array list and walking linked list") {
+      {
+        ArrayList array_list(1, GrowthPolicy::Geometric(2.0));
+        for (int index = 0; index < 4; index++) {
+          array_list.Add(Element::CHERRY_PIE);  // 1 -> 2 -> 4: копируются 1 и 2 элемента
+        }
+
+        LinkedList linked_list;
+        for (int index = 0; index < 5; index++) {
+          linked_list.Add(Element::DRAGON_BALL);
+        }
+        linked_list.Get(4);  // с хвоста: 0 узлов
+        linked_list.Get(2);  // от пальца: 2 узла
+        linked_list.IndexOf(Element::SECRET_BOX);  // весь список: 5 узлов
+        linked_list.Remove(0);
+
+        CHECK_THROWS_AS(linked_list.Get(10), std::out_of_range);
+        CHECK_THROWS_AS(array_list.Set(-1, Element::SECRET_BOX), std::out_of_range);
+      }
+      const OperationStats stats = Stats();
+
+      THEN("counters should match the operations when collection is enabled") {
+        if (kStatsEnabled) {
+          CHECK(stats.num_resizes == 2);
+          CHECK(stats.resize_bytes_copied == 3 * static_cast<long long>(sizeof(Element)));
+          CHECK(stats.num_nodes_allocated == 5);
+          CHECK(stats.num_nodes_freed == 5);
+          CHECK(stats.num_nodes_traversed == 7);
+          CHECK(stats.num_out_of_range_errors == 2);
+        } else {
+          CHECK(stats.num_resizes == 0);
+          CHECK(stats.num_nodes_allocated == 0);
+          CHECK(stats.num_nodes_traversed == 0);
+          CHECK(stats.num_out_of_range_errors == 0);
+        }
+      }
+
+      AND_THEN("reset should zero all counters") {
+        ResetStats();
+        const OperationStats reset_stats = Stats();
+        CHECK(reset_stats.num_resizes == 0);
+        CHECK(reset_stats.resize_bytes_copied == 0);
+        CHECK(reset_stats.num_nodes_allocated == 0);
+        CHECK(reset_stats.num_nodes_freed == 0);
+        CHECK(reset_stats.num_nodes_traversed == 0);
+        CHECK(reset_stats.num_out_of_range_errors == 0);
+      }
+    }
+  }
+}
@@ -0,0 +1,179 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "element.hpp"
+#include "generation.hpp"
+
+#include "array_list.hpp"
+#include "packed_array_list.hpp"
+
+using namespace std;
+using namespace itis;
+using namespace Catch::Matchers;
+
+SCENARIO("create empty packed array list") {
+
+  WHEN("using a default constructor") {
+    const auto list = make_unique<PackedArrayList>();
+
+    THEN("list should be empty with one word of capacity") {
+      CHECK(list->GetSize() == 0);
+      CHECK(list->GetCapacity() == PackedArrayList::kInitCapacity);
+      CHECK(list->GetMemoryUsage() == sizeof(uint64_t));
+    }
+
+    AND_THEN("all designated elements should be set to Element::UNINITIALIZED") {
+      CHECK(*list == vector<Element>(PackedArrayList::kInitCapacity, Element::UNINITIALIZED));
+    }
+  }
+
+  AND_WHEN("using capacity constructor") {
+    const int capacity = GENERATE(1, 21, 22, 100);
+    const auto list = make_unique<PackedArrayList>(capacity);
+
+    THEN("capacity should be rounded up to whole words") {
+      CAPTURE(capacity);
+      CHECK(list->GetCapacity() >= capacity);
+      CHECK(list->GetCapacity() % PackedArrayList::kElementsPerWord == 0);
+      CHECK(list->GetCapacity() - capacity < PackedArrayList::kElementsPerWord);
+    }
+  }
+
+  AND_WHEN("using non-positive capacity") {
+    const int capacity = GENERATE(range(-5, 1));
+
+    THEN("exception must be thrown") {
+      CHECK_THROWS_AS(PackedArrayList(capacity), std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("packed array list behaves like array list") {
+
+  GIVEN("packed array list and reference vector") {
+    const int num_operations = GENERATE(10, 100, 2000);
+    const auto seed = GENERATE(take(3, random(0u, 100000u)));
+
+    PackedArrayList list(1);
+    vector<Element> elements_ref;
+
+    auto engine = mt19937(seed);
+    auto element_dist = uniform_int_distribution<>(0, static_cast<int>(Element::UNINITIALIZED) - 1);
+    auto operation_dist = uniform_int_distribution<>(0, 9);
+
+    WHEN("applying random operations") {
+      for (int operation = 0; operation < num_operations; operation++) {
+        const auto e = static_cast<Element>(element_dist(engine));
+        const int kind = operation_dist(engine);
+        const int size = static_cast<int>(elements_ref.size());
+
+        if (kind < 4 || size == 0) {
+          list.Add(e);
+          elements_ref.push_back(e);
+        } else if (kind < 6) {
+          const int index = uniform_int_distribution<>(0, size)(engine);
+          list.Insert(index, e);
+          elements_ref.insert(elements_ref.begin() + index, e);
+        } else if (kind < 8) {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          REQUIRE(list.Remove(index) == elements_ref.at(index));
+          elements_ref.erase(elements_ref.begin() + index);
+        } else {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          list.Set(index, e);
+          elements_ref.at(index) = e;
+        }
+      }
+
+      CAPTURE(num_operations, seed);
+
+      THEN("elements and unused cells should match the reference") {
+        REQUIRE(list.GetSize() == static_cast<int>(elements_ref.size()));
+
+        vector<Element> cells_ref = elements_ref;
+        cells_ref.resize(list.GetCapacity(), Element::UNINITIALIZED);
+        CHECK(list == cells_ref);
+      }
+
+      AND_THEN("bulk unpack should return all elements") {
+        vector<Element> unpacked(elements_ref.size());
+        list.Unpack(0, list.GetSize(), unpacked.data());
+        CHECK(unpacked == elements_ref);
+      }
+
+      AND_THEN("search should find first occurrences") {
+        for (int id = 0; id <= static_cast<int>(Element::UNINITIALIZED); id++) {
+          const auto e = static_cast<Element>(id);
+          const auto it = std::find(elements_ref.begin(), elements_ref.end(), e);
+          const int index_ref = it == elements_ref.end() ? PackedArrayList::kNotFoundElementIndex
+                                                         : static_cast<int>(it - elements_ref.begin());
+          CHECK(list.IndexOf(e) == index_ref);
+          CHECK(list.Contains(e) == (it != elements_ref.end()));
+        }
+      }
+
+      AND_THEN("clearing should reset all cells") {
+        const int capacity = list.GetCapacity();
+        list.Clear();
+        CHECK(list.IsEmpty());
+        CHECK(list == vector<Element>(capacity, Element::UNINITIALIZED));
+      }
+    }
+  }
+}
+
+SCENARIO("unpack packed array list ranges") {
+
+  GIVEN("packed array list spanning several words") {
+    const vector<Element> elements_ref = utils::generate_elements(100, 100);
+
+    PackedArrayList list;
+    list.AddRange(elements_ref.data(), static_cast<int>(elements_ref.size()));
+
+    WHEN("unpacking a sub-range") {
+      const int from = GENERATE(0, 1, 20, 21, 42, 99);
+      const int count = GENERATE_COPY(0, 1, 100 - from);
+
+      vector<Element> unpacked(count);
+      list.Unpack(from, count, unpacked.data());
+
+      THEN("elements of the sub-range should be returned") {
+        CAPTURE(from, count);
+        CHECK(unpacked == vector<Element>(elements_ref.begin() + from, elements_ref.begin() + from + count));
+      }
+    }
+
+    AND_WHEN("unpacking an invalid range") {
+
+      THEN("exception should be thrown") {
+        Element out[2];
+        CHECK_THROWS_AS(list.Unpack(99, 2, out), std::out_of_range);
+        CHECK_THROWS_AS(list.Unpack(-1, 1, out), std::out_of_range);
+      }
+    }
+  }
+}
+
+SCENARIO("packed array list saves memory") {
+
+  GIVEN("one million elements") {
+    const int num_elements = 1'000'000;
+
+    PackedArrayList packed(num_elements);
+    ArrayList plain(num_elements);
+
+    for (int index = 0; index < num_elements; index++) {
+      packed.Add(static_cast<Element>(index % 5));
+      plain.Add(static_cast<Element>(index % 5));
+    }
+
+    THEN("packed storage should be at least 10 times smaller") {
+      const auto plain_memory = static_cast<long long>(sizeof(Element)) * plain.GetCapacity();
+      CHECK(packed.GetMemoryUsage() * 10 <= plain_memory);
+    }
+  }
+}
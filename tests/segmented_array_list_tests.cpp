@@ -0,0 +1,165 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "element.hpp"
+#include "generation.hpp"
+#include "counting_resource.hpp"
+
+#include "segmented_array_list.hpp"
+
+using namespace std;
+using namespace itis;
+using namespace Catch::Matchers;
+
+SCENARIO("create empty segmented array list") {
+
+  WHEN("constructing an empty list") {
+    const SegmentedArrayList list;
+
+    THEN("list should have no chunks") {
+      CHECK(list.IsEmpty());
+      CHECK(list.GetCapacity() == 0);
+      CHECK(list == vector<Element>{});
+      CHECK_THROWS_AS(list.Get(0), std::out_of_range);
+    }
+  }
+
+  AND_WHEN("passing null memory resource") {
+
+    THEN("exception should be thrown") {
+      CHECK_THROWS_AS(SegmentedArrayList(nullptr), std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("segmented array list behaves like an array") {
+
+  GIVEN("segmented array list and reference vector") {
+    constexpr int kChunkSize = SegmentedArrayList::kChunkSize;
+    const int num_initial = GENERATE(0, SegmentedArrayList::kChunkSize - 1, SegmentedArrayList::kChunkSize,
+                                     2 * SegmentedArrayList::kChunkSize + 5);
+    const auto seed = GENERATE(take(2, random(0u, 100000u)));
+
+    utils::CountingResource resource;
+    SegmentedArrayList list(&resource);
+    vector<Element> elements_ref = utils::generate_elements(num_initial, num_initial);
+    list.AddRange(elements_ref.data(), num_initial);
+
+    auto engine = mt19937(seed);
+    auto element_dist = uniform_int_distribution<>(0, static_cast<int>(Element::UNINITIALIZED) - 1);
+    auto operation_dist = uniform_int_distribution<>(0, 9);
+
+    CAPTURE(num_initial, seed);
+
+    WHEN("applying random operations") {
+      for (int operation = 0; operation < 300; operation++) {
+        const auto e = static_cast<Element>(element_dist(engine));
+        const int kind = operation_dist(engine);
+        const int size = static_cast<int>(elements_ref.size());
+
+        if (kind < 3 || size == 0) {
+          list.Add(e);
+          elements_ref.push_back(e);
+        } else if (kind < 5) {
+          const int index = uniform_int_distribution<>(0, size)(engine);
+          list.Insert(index, e);
+          elements_ref.insert(elements_ref.begin() + index, e);
+        } else if (kind < 8) {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          REQUIRE(list.Remove(index) == elements_ref.at(index));
+          elements_ref.erase(elements_ref.begin() + index);
+        } else {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          list.Set(index, e);
+          elements_ref.at(index) = e;
+        }
+      }
+
+      THEN("elements and free cells should match the reference") {
+        REQUIRE(list == elements_ref);
+        CHECK(list.GetCapacity() % kChunkSize == 0);
+        CHECK(resource.bytes_in_use >= static_cast<size_t>(list.GetCapacity()) * sizeof(Element));
+      }
+
+      AND_THEN("search should match the reference") {
+        for (int id = 0; id <= static_cast<int>(Element::UNINITIALIZED); id++) {
+          const auto e = static_cast<Element>(id);
+          const auto it = std::find(elements_ref.begin(), elements_ref.end(), e);
+          const int index_ref = it == elements_ref.end() ? SegmentedArrayList::kNotFoundElementIndex
+                                                         : static_cast<int>(it - elements_ref.begin());
+          CHECK(list.IndexOf(e) == index_ref);
+          CHECK(list.Contains(e) == (it != elements_ref.end()));
+          CHECK(list.Count(e) == std::count(elements_ref.begin(), elements_ref.end(), e));
+        }
+      }
+
+      AND_THEN("moved and cloned lists should keep the elements") {
+        SegmentedArrayList clone = list.Clone();
+        const SegmentedArrayList moved{std::move(list)};
+        CHECK(clone == elements_ref);
+        CHECK(moved == elements_ref);
+        CHECK(list.IsEmpty());
+
+        clone.Add(Element::GRAVITY_GUN);
+        CHECK(moved == elements_ref);
+      }
+
+      AND_THEN("clearing should keep the chunks and shrinking should free them") {
+        const int capacity = list.GetCapacity();
+        list.Clear();
+        CHECK(list == vector<Element>{});
+        CHECK(list.GetCapacity() == capacity);
+
+        list.ShrinkToFit();
+        CHECK(list.GetCapacity() == 0);
+        CHECK(resource.bytes_in_use == 0);
+        CHECK(resource.num_deallocations == resource.num_allocations);
+      }
+    }
+  }
+}
+
+SCENARIO("grow segmented array list without moving elements") {
+
+  GIVEN("segmented array list with one full chunk") {
+    constexpr int kChunkSize = SegmentedArrayList::kChunkSize;
+    const vector<Element> elements = utils::generate_elements(kChunkSize, kChunkSize);
+
+    SegmentedArrayList list;
+    list.AddRange(elements.data(), kChunkSize);
+
+    const Element *first = list.ElementPointer(0);
+    const Element *last = list.ElementPointer(kChunkSize - 1);
+
+    WHEN("adding many more elements") {
+      for (int index = 0; index < 40 * kChunkSize; index++) {
+        list.Add(static_cast<Element>(index % 5));
+      }
+      list.Reserve(100 * kChunkSize);
+
+      THEN("pointers to existing cells should stay valid") {
+        CHECK(list.ElementPointer(0) == first);
+        CHECK(list.ElementPointer(kChunkSize - 1) == last);
+        CHECK(*first == elements.front());
+        CHECK(*last == elements.back());
+        CHECK(list.GetCapacity() == 100 * kChunkSize);
+      }
+    }
+
+    AND_WHEN("removing elements and shrinking") {
+      list.Add(Element::SECRET_BOX);
+      list.Remove(kChunkSize);
+      list.ShrinkToFit();
+
+      THEN("only the chunk with elements should remain") {
+        CHECK(list.GetCapacity() == kChunkSize);
+        CHECK(list.ElementPointer(0) == first);
+        CHECK(list == elements);
+      }
+    }
+  }
+}
@@ -0,0 +1,208 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "element.hpp"
+#include "generation.hpp"
+#include "counting_resource.hpp"
+
+#include "array_list.hpp"
+#include "small_array_list.hpp"
+
+using namespace std;
+using namespace itis;
+using namespace Catch::Matchers;
+
+SCENARIO("keep small array list elements inline") {
+
+  GIVEN("counting memory resource") {
+    utils::CountingResource resource;
+
+    WHEN("adding no more than N elements") {
+      const int num_elements = GENERATE(0, 1, 8);
+      const vector<Element> elements_ref = utils::generate_elements(num_elements, num_elements);
+
+      SmallArrayList<8> list(GrowthPolicy::Geometric(), &resource);
+      list.AddRange(elements_ref.data(), num_elements);
+
+      THEN("no memory should be allocated") {
+        CAPTURE(num_elements);
+        CHECK(list.IsInline());
+        CHECK(list.GetCapacity() == 8);
+        CHECK(resource.num_allocations == 0);
+
+        vector<Element> cells_ref = elements_ref;
+        cells_ref.resize(8, Element::UNINITIALIZED);
+        CHECK(list == cells_ref);
+      }
+    }
+
+    AND_WHEN("adding more than N elements") {
+      {
+        SmallArrayList<4> list(GrowthPolicy::Geometric(), &resource);
+        for (int index = 0; index < 5; index++) {
+          list.Add(static_cast<Element>(index));
+        }
+
+        THEN("elements should spill to the heap") {
+          CHECK_FALSE(list.IsInline());
+          CHECK(list.GetCapacity() == 8);
+          CHECK(resource.num_allocations == 1);
+          CHECK(list == vector<Element>{Element::CHERRY_PIE, Element::SECRET_BOX, Element::DRAGON_BALL,
+                                        Element::GRAVITY_GUN, Element::BEAUTIFUL_FLOWERS, Element::UNINITIALIZED,
+                                        Element::UNINITIALIZED, Element::UNINITIALIZED});
+        }
+      }
+
+      AND_THEN("heap memory should be returned to the resource") {
+        CHECK(resource.num_allocations == resource.num_deallocations);
+        CHECK(resource.bytes_in_use == 0);
+      }
+    }
+  }
+
+  AND_GIVEN("null memory resource") {
+
+    THEN("exception should be thrown") {
+      CHECK_THROWS_AS(SmallArrayList<4>(GrowthPolicy::Geometric(), nullptr), std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("small array list behaves like array list") {
+
+  GIVEN("small array list and reference vector") {
+    const int num_operations = GENERATE(10, 100, 1000);
+    const auto seed = GENERATE(take(3, random(0u, 100000u)));
+
+    SmallArrayList<4> list;
+    vector<Element> elements_ref;
+
+    auto engine = mt19937(seed);
+    auto element_dist = uniform_int_distribution<>(0, static_cast<int>(Element::UNINITIALIZED) - 1);
+    auto operation_dist = uniform_int_distribution<>(0, 9);
+
+    WHEN("applying random operations") {
+      for (int operation = 0; operation < num_operations; operation++) {
+        const auto e = static_cast<Element>(element_dist(engine));
+        const int kind = operation_dist(engine);
+        const int size = static_cast<int>(elements_ref.size());
+
+        if (kind < 4 || size == 0) {
+          list.Add(e);
+          elements_ref.push_back(e);
+        } else if (kind < 6) {
+          const int index = uniform_int_distribution<>(0, size)(engine);
+          list.Insert(index, e);
+          elements_ref.insert(elements_ref.begin() + index, e);
+        } else if (kind < 8) {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          REQUIRE(list.Remove(index) == elements_ref.at(index));
+          elements_ref.erase(elements_ref.begin() + index);
+        } else {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          list.Set(index, e);
+          elements_ref.at(index) = e;
+        }
+      }
+
+      CAPTURE(num_operations, seed);
+
+      THEN("elements and unused cells should match the reference") {
+        REQUIRE(list.GetSize() == static_cast<int>(elements_ref.size()));
+
+        vector<Element> cells_ref = elements_ref;
+        cells_ref.resize(list.GetCapacity(), Element::UNINITIALIZED);
+        CHECK(list == cells_ref);
+      }
+
+      AND_THEN("search should match the reference") {
+        for (int id = 0; id < static_cast<int>(Element::UNINITIALIZED); id++) {
+          const auto e = static_cast<Element>(id);
+          const auto it = std::find(elements_ref.begin(), elements_ref.end(), e);
+          const int index_ref = it == elements_ref.end() ? SmallArrayList<4>::kNotFoundElementIndex
+                                                         : static_cast<int>(it - elements_ref.begin());
+          CHECK(list.IndexOf(e) == index_ref);
+          CHECK(list.Count(e) == std::count(elements_ref.begin(), elements_ref.end(), e));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("move, swap and convert small array list") {
+
+  GIVEN("inline and spilled lists") {
+    const vector<Element> short_ref = utils::generate_elements(3, 3);
+    const vector<Element> long_ref = utils::generate_elements(10, 10);
+
+    SmallArrayList<4> short_list;
+    short_list.AddRange(short_ref.data(), 3);
+
+    SmallArrayList<4> long_list;
+    long_list.AddRange(long_ref.data(), 10);
+
+    const auto elements_of = [](const SmallArrayList<4> &list) {
+      vector<Element> elements;
+      for (int index = 0; index < list.GetSize(); index++) {
+        elements.push_back(list.Get(index));
+      }
+      return elements;
+    };
+
+    WHEN("moving the lists") {
+      SmallArrayList<4> moved_short{std::move(short_list)};
+      SmallArrayList<4> moved_long{std::move(long_list)};
+
+      THEN("elements should be moved and sources should become empty inline lists") {
+        CHECK(elements_of(moved_short) == short_ref);
+        CHECK(elements_of(moved_long) == long_ref);
+        CHECK(moved_short.IsInline());
+        CHECK_FALSE(moved_long.IsInline());
+
+        CHECK(short_list.IsEmpty());
+        CHECK(long_list.IsEmpty());
+        CHECK(long_list.IsInline());
+        CHECK(long_list == vector<Element>(4, Element::UNINITIALIZED));
+      }
+    }
+
+    AND_WHEN("swapping the lists") {
+      swap(short_list, long_list);
+
+      THEN("elements should be exchanged") {
+        CHECK(elements_of(short_list) == long_ref);
+        CHECK(elements_of(long_list) == short_ref);
+        CHECK(long_list.IsInline());
+      }
+    }
+
+    AND_WHEN("cloning the lists") {
+      const SmallArrayList<4> clone = long_list.Clone();
+
+      THEN("clone should have the same elements and capacity") {
+        CHECK(elements_of(clone) == long_ref);
+        CHECK(clone.GetCapacity() == long_list.GetCapacity());
+      }
+    }
+
+    AND_WHEN("converting to array list and back") {
+      const ArrayList list = long_list.ToArrayList();
+      const SmallArrayList<4> converted_long(list);
+      const SmallArrayList<4> converted_short(short_list.ToArrayList());
+
+      THEN("elements should be preserved") {
+        REQUIRE(list.GetSize() == 10);
+        for (int index = 0; index < list.GetSize(); index++) {
+          CHECK(list.Get(index) == long_ref.at(index));
+        }
+        CHECK(elements_of(converted_long) == long_ref);
+        CHECK(elements_of(converted_short) == short_ref);
+        CHECK(converted_short.IsInline());
+      }
+    }
+  }
+}
@@ -0,0 +1,119 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "thread_pool.hpp"
+
+using namespace std;
+using namespace itis;
+using namespace Catch::Matchers;
+
+SCENARIO("create thread pool") {
+
+  WHEN("constructing pools with different numbers of workers") {
+    const int num_workers = GENERATE(0, 1, 3);
+    ThreadPool pool(num_workers);
+
+    THEN("pool should have the requested workers") {
+      CHECK(pool.GetNumWorkers() == num_workers);
+    }
+  }
+
+  AND_WHEN("passing invalid arguments") {
+
+    THEN("exceptions should be thrown") {
+      CHECK_THROWS_AS(ThreadPool(-1), std::invalid_argument);
+
+      ThreadPool pool(1);
+      CHECK_THROWS_AS(pool.ParallelFor(0, 10, 0, [](int, int) {}), std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("run parallel loops on thread pool") {
+
+  GIVEN("thread pool and a range") {
+    const int num_workers = GENERATE(0, 1, 3);
+    const int num_indices = GENERATE(0, 1, 100, 5000);
+    const int grain = GENERATE(1, 7, 1000);
+
+    ThreadPool pool(num_workers);
+
+    CAPTURE(num_workers, num_indices, grain);
+
+    WHEN("visiting every index of the range") {
+      vector<atomic<int>> num_visits(num_indices);
+      atomic<bool> parts_valid{true};
+
+      pool.ParallelFor(0, num_indices, grain, [&](int begin, int end) {
+        if (begin >= end || end - begin > grain) parts_valid = false;
+        for (int index = begin; index < end; index++) num_visits[index]++;
+      });
+
+      THEN("each index should be visited exactly once") {
+        CHECK(parts_valid);
+        CHECK(std::all_of(num_visits.begin(), num_visits.end(), [](const atomic<int> &n) { return n == 1; }));
+      }
+    }
+
+    AND_WHEN("running nested parallel loops") {
+      atomic<long long> sum{0};
+
+      pool.ParallelFor(0, 8, 1, [&](int outer, int) {
+        pool.ParallelFor(0, num_indices, grain, [&](int begin, int end) {
+          for (int index = begin; index < end; index++) sum += outer;
+        });
+      });
+
+      THEN("all inner loops should complete") {
+        CHECK(sum == 28LL * num_indices);
+      }
+    }
+
+    AND_WHEN("loop body throws") {
+      atomic<int> num_parts{0};
+      const int num_parts_ref = (num_indices + grain - 1) / grain;
+
+      const auto run = [&] {
+        pool.ParallelFor(0, num_indices, grain, [&](int begin, int) {
+          num_parts++;
+          if (begin == 0) throw std::runtime_error("first part failed");
+        });
+      };
+
+      THEN("exception should be rethrown after all parts complete") {
+        if (num_indices > 0) {
+          CHECK_THROWS_AS(run(), std::runtime_error);
+        } else {
+          CHECK_NOTHROW(run());
+        }
+        CHECK(num_parts == num_parts_ref);
+      }
+    }
+  }
+}
+
+SCENARIO("wait for parts taken by workers") {
+
+  GIVEN("thread pool with several workers") {
+    ThreadPool pool(3);
+
+    WHEN("parts taken by workers run much longer than the caller's part") {
+      atomic<int> num_finished{0};
+
+      pool.ParallelFor(0, 4, 1, [&](int begin, int) {
+        if (begin != 0) std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        num_finished++;
+      });
+
+      THEN("caller should return only after all parts complete") {
+        CHECK(num_finished == 4);
+      }
+    }
+  }
+}
@@ -0,0 +1,167 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "element.hpp"
+#include "generation.hpp"
+#include "counting_resource.hpp"
+
+#include "unrolled_linked_list.hpp"
+
+using namespace std;
+using namespace itis;
+using namespace Catch::Matchers;
+
+SCENARIO("create empty unrolled linked list") {
+
+  WHEN("constructing an empty list") {
+    const UnrolledLinkedList list;
+
+    THEN("list should have no nodes") {
+      CHECK(list.IsEmpty());
+      CHECK(list.GetNumNodes() == 0);
+      CHECK(list.head() == Element::UNINITIALIZED);
+      CHECK(list.tail() == Element::UNINITIALIZED);
+      CHECK(list == vector<Element>{});
+    }
+  }
+
+  AND_WHEN("passing null memory resource") {
+
+    THEN("exception should be thrown") {
+      CHECK_THROWS_AS(UnrolledLinkedList(nullptr), std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("pack unrolled linked list elements into cache line nodes") {
+
+  GIVEN("list filled by appending") {
+    const int num_elements = GENERATE(1, 12, 13, 100);
+    const vector<Element> elements_ref = utils::generate_elements(num_elements, num_elements);
+
+    const UnrolledLinkedList list(elements_ref);
+
+    THEN("nodes should be filled completely") {
+      CAPTURE(num_elements);
+      CHECK(list == elements_ref);
+      CHECK(list.GetNumNodes() == (num_elements + UnrolledLinkedList::kElementsPerNode - 1) /
+          UnrolledLinkedList::kElementsPerNode);
+      CHECK(list.head() == elements_ref.front());
+      CHECK(list.tail() == elements_ref.back());
+    }
+  }
+
+  AND_GIVEN("full node") {
+    vector<Element> elements_ref(UnrolledLinkedList::kElementsPerNode, Element::CHERRY_PIE);
+    UnrolledLinkedList list(elements_ref);
+
+    WHEN("inserting into the full node") {
+      list.Insert(1, Element::SECRET_BOX);
+      elements_ref.insert(elements_ref.begin() + 1, Element::SECRET_BOX);
+
+      THEN("node should be split in two") {
+        CHECK(list == elements_ref);
+        CHECK(list.GetNumNodes() == 2);
+      }
+
+      AND_WHEN("removing elements from the first node") {
+        list.Remove(0);
+        list.Remove(0);
+        elements_ref.erase(elements_ref.begin(), elements_ref.begin() + 2);
+
+        THEN("underflowing node should be merged with the next one") {
+          CHECK(list == elements_ref);
+          CHECK(list.GetNumNodes() == 1);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("unrolled linked list behaves like a list") {
+
+  GIVEN("unrolled linked list and reference vector") {
+    const int num_operations = GENERATE(10, 100, 2000);
+    const auto seed = GENERATE(take(3, random(0u, 100000u)));
+
+    utils::CountingResource resource;
+    UnrolledLinkedList list(&resource);
+    vector<Element> elements_ref;
+
+    auto engine = mt19937(seed);
+    auto element_dist = uniform_int_distribution<>(0, static_cast<int>(Element::UNINITIALIZED) - 1);
+    auto operation_dist = uniform_int_distribution<>(0, 9);
+
+    WHEN("applying random operations") {
+      for (int operation = 0; operation < num_operations; operation++) {
+        const auto e = static_cast<Element>(element_dist(engine));
+        const int kind = operation_dist(engine);
+        const int size = static_cast<int>(elements_ref.size());
+
+        if (kind < 3 || size == 0) {
+          list.Add(e);
+          elements_ref.push_back(e);
+        } else if (kind < 5) {
+          const int index = uniform_int_distribution<>(0, size)(engine);
+          list.Insert(index, e);
+          elements_ref.insert(elements_ref.begin() + index, e);
+        } else if (kind < 8) {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          REQUIRE(list.Remove(index) == elements_ref.at(index));
+          elements_ref.erase(elements_ref.begin() + index);
+        } else {
+          const int index = uniform_int_distribution<>(0, size - 1)(engine);
+          list.Set(index, e);
+          elements_ref.at(index) = e;
+        }
+      }
+
+      CAPTURE(num_operations, seed);
+
+      THEN("elements should match the reference") {
+        REQUIRE(list == elements_ref);
+
+        for (int index = 0; index < list.GetSize(); index++) {
+          REQUIRE(list.Get(index) == elements_ref.at(index));
+        }
+      }
+
+      AND_THEN("nodes should stay at least half full") {
+        const int size = list.GetSize();
+        CHECK(list.GetNumNodes() <= size / UnrolledLinkedList::kMinElementsPerNode + 1);
+        CHECK(resource.bytes_in_use == list.GetNumNodes() * sizeof(UnrolledNode));
+      }
+
+      AND_THEN("search should match the reference") {
+        for (int id = 0; id < static_cast<int>(Element::UNINITIALIZED); id++) {
+          const auto e = static_cast<Element>(id);
+          const auto it = std::find(elements_ref.begin(), elements_ref.end(), e);
+          const int index_ref = it == elements_ref.end() ? UnrolledLinkedList::kNotFoundElementIndex
+                                                         : static_cast<int>(it - elements_ref.begin());
+          CHECK(list.IndexOf(e) == index_ref);
+          CHECK(list.Contains(e) == (it != elements_ref.end()));
+          CHECK(list.Count(e) == std::count(elements_ref.begin(), elements_ref.end(), e));
+        }
+      }
+
+      AND_THEN("moved and cloned lists should keep the elements") {
+        const UnrolledLinkedList clone = list.Clone();
+        const UnrolledLinkedList moved{std::move(list)};
+        CHECK(clone == elements_ref);
+        CHECK(moved == elements_ref);
+        CHECK(list.IsEmpty());
+      }
+
+      AND_THEN("clearing should free all nodes") {
+        list.Clear();
+        CHECK(list.IsEmpty());
+        CHECK(list.GetNumNodes() == 0);
+        CHECK(resource.bytes_in_use == 0);
+      }
+    }
+  }
+}